@@ -26,6 +26,9 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 
+#include "escritor.h"
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* === Header for C++ compatibility ================================================================================ */
@@ -36,6 +39,8 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+#define ALUMNO_LARGO_MAX 1024 //!< cantidad máxima de caracteres del nombre y del apellido, sin contar el '\0'
+
 /* === Public data type declarations =============================================================================== */
 
 //! Estructura que representa un alumno
@@ -50,11 +55,67 @@ typedef struct alumno_s * alumno_t;
     * @param nombre      Nombre del alumno
     * @param apellido    Apellido del alumno
     * @param documento   Número de documento del alumno
-    * @return alumno_t   Referencia al nuevo alumno creado
+    * @return alumno_t   Referencia al nuevo alumno creado, o NULL si el nombre o el apellido tienen más de
+    *                    ALUMNO_LARGO_MAX caracteres o no queda memoria para guardarlos
     */
 
 alumno_t AlumnoCrear(char * nombre, char * apellido, uint32_t documento);
 
+/*
+ * @brief Función para liberar un alumno, cuya instancia queda disponible para el próximo alumno que se cree
+ *
+ * @param alumno referencia al alumno a liberar, que no debe volver a usarse
+ */
+void AlumnoDestruir(alumno_t alumno);
+
+/*
+ * @brief Función para agregar un alumno al índice por documento
+ *
+ * @param alumno referencia al alumno a indexar
+ * @return bool devuelve true si se indexo el alumno, false si ya hay un alumno indexado con el mismo documento o no
+ * hay memoria para agrandar el índice
+ */
+bool AlumnoIndexar(alumno_t alumno);
+
+/*
+ * @brief Función para quitar un alumno del índice por documento, los alumnos destruidos se quitan solos
+ *
+ * @param alumno referencia al alumno a quitar
+ */
+void AlumnoDesindexar(alumno_t alumno);
+
+/*
+ * @brief Función para buscar un alumno indexado a partir de su documento
+ *
+ * @param documento número de documento a buscar
+ * @return alumno_t referencia al alumno o NULL si no hay un alumno indexado con ese documento
+ */
+alumno_t AlumnoBuscarPorDocumento(uint32_t documento);
+
+/*
+ * @brief Función para consultar el documento de un alumno
+ *
+ * @param alumno referencia al alumno
+ * @return uint32_t número de documento del alumno
+ */
+uint32_t AlumnoDocumento(alumno_t alumno);
+
+/*
+ * @brief Función para consultar el nombre de un alumno
+ *
+ * @param alumno referencia al alumno
+ * @return const char* nombre del alumno terminado en '\0', valido mientras el alumno exista
+ */
+const char * AlumnoNombre(alumno_t alumno);
+
+/*
+ * @brief Función para consultar el apellido de un alumno
+ *
+ * @param alumno referencia al alumno
+ * @return const char* apellido del alumno terminado en '\0', valido mientras el alumno exista
+ */
+const char * AlumnoApellido(alumno_t alumno);
+
 /*
  * @brief Función para serealizar los datos de un alumno
  *
@@ -65,6 +126,64 @@ alumno_t AlumnoCrear(char * nombre, char * apellido, uint32_t documento);
  */
 int AlumnoSerializar(alumno_t alumno, char buffer[], uint32_t size);
 
+/*
+ * @brief Función para calcular cuántos caracteres ocupa un alumno serializado, sin serializarlo
+ *
+ * @param alumno referencia al alumno a medir
+ * @return size_t cantidad exacta de caracteres que escribe AlumnoSerializar, escapes incluidos y sin contar el '\0';
+ * el buffer necesita un byte más
+ */
+size_t AlumnoTamanoSerializado(alumno_t alumno);
+
+/*
+ * @brief Función para serializar un alumno al final del contenido de un escritor
+ *
+ * El escritor se agranda una sola vez si hace falta, con el tamaño exacto del alumno, y conserva su memoria para los
+ * alumnos siguientes.
+ *
+ * @param alumno referencia al alumno a serializar
+ * @param escritor escritor donde se agrega el alumno serializado
+ * @return int cantidad de caracteres agregados, o -1 si no hay memoria para agrandar el escritor
+ */
+int AlumnoSerializarEn(alumno_t alumno, escritor_t escritor);
+
+/*
+ * @brief Función para escribir un arreglo JSON con los datos de muchos alumnos en un archivo o tuberia
+ *
+ * Los alumnos se serializan en paralelo por tandas y cada tanda se escribe en orden con writev mientras se serializa
+ * la siguiente, sin que quien llama tenga que reservar un buffer para el lote completo.
+ *
+ * @param alumnos arreglo de referencias a los alumnos a serializar
+ * @param cantidad cantidad de alumnos del arreglo
+ * @param descriptor descriptor del archivo o tuberia donde se escribe el arreglo
+ * @return int devuelve 0 si se escribio el arreglo completo o -1 si hubo un error, en cuyo caso puede haberse escrito
+ * una parte
+ */
+int AlumnoSerializarLote(alumno_t alumnos[], size_t cantidad, int descriptor);
+
+/*
+ * @brief Función para crear un alumno a partir de un texto con el formato exacto que genera AlumnoSerializar
+ *
+ * @param buffer texto con los datos del alumno, que puede terminar en '\0' antes de ocupar todo el espacio
+ * @param size cantidad de caracteres disponibles en el buffer
+ * @return alumno_t referencia al nuevo alumno o NULL si el texto no tiene el formato esperado o no hay instancias
+ */
+alumno_t AlumnoDeserializar(const char buffer[], uint32_t size);
+
+/*
+ * @brief Función para crear muchos alumnos a partir de un arreglo JSON como el que escribe AlumnoSerializarLote
+ *
+ * El archivo se lee de a tramos grandes y cada alumno se analiza en una sola pasada, sin reservar memoria por campo.
+ * Entre los elementos del arreglo puede haber espacios y saltos de linea.
+ *
+ * @param descriptor descriptor del archivo o tuberia del que se lee el arreglo
+ * @param alumnos arreglo donde se guardan las referencias a los alumnos creados, en el orden del archivo
+ * @param capacidad cantidad de referencias que entran en el arreglo
+ * @return int devuelve la cantidad de alumnos creados o -1 si el texto no tiene el formato esperado, hay más alumnos
+ * que capacidad o hubo un error de lectura, en cuyo caso se destruyen los alumnos que se habian creado
+ */
+int AlumnoDeserializarLote(int descriptor, alumno_t alumnos[], size_t capacidad);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
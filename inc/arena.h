@@ -0,0 +1,101 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+/** @file arena.h
+ ** @brief declaración del módulo de asignación de memoria por avance sobre un bloque provisto por el usuario
+ **
+ ** Una arena reparte un bloque de memoria fijo avanzando un desplazamiento; los bloques asignados no se liberan
+ ** uno por uno sino todos juntos al reiniciar la arena. Así los objetos de vida corta quedan contiguos en memoria y
+ ** desarmarlos cuesta una sola operación. Se puede asignar desde varios hilos a la vez.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a una arena de memoria
+typedef struct arena_s * arena_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una arena sobre un bloque de memoria provisto por el usuario.
+ *
+ * Los datos de control de la arena se guardan al comienzo del propio bloque, que debe permanecer válido mientras se
+ * use la arena. No hace falta destruir la arena: basta con dejar de usar el bloque.
+ *
+ * @param memoria Bloque de memoria a repartir.
+ * @param tamano Cantidad de bytes del bloque.
+ * @return Referencia a la arena, o NULL si el bloque es demasiado chico para contenerla.
+ */
+arena_t ArenaCrear(void * memoria, size_t tamano);
+
+/**
+ * @brief Asigna un bloque de la arena, alineado para cualquier tipo de dato.
+ *
+ * @param arena Arena de la que se asigna.
+ * @param tamano Cantidad de bytes a asignar.
+ * @return Puntero al bloque asignado, o NULL si la arena no tiene espacio suficiente.
+ */
+void * ArenaAsignar(arena_t arena, size_t tamano);
+
+/**
+ * @brief Devuelve a la arena un bloque si es el último que se asignó.
+ *
+ * Permite deshacer una asignación que resultó innecesaria; si después se asignó otro bloque, no se hace nada y la
+ * memoria se recupera recién al reiniciar la arena.
+ *
+ * @param arena Arena de la que se asignó el bloque.
+ * @param bloque Bloque obtenido con ArenaAsignar.
+ * @param tamano Cantidad de bytes con la que se asignó el bloque.
+ */
+void ArenaDevolver(arena_t arena, void * bloque, size_t tamano);
+
+/**
+ * @brief Libera de una vez todos los bloques asignados en la arena.
+ *
+ * Los punteros obtenidos antes dejan de ser válidos. No debe llamarse mientras otros hilos asignan de la arena.
+ *
+ * @param arena Arena a reiniciar.
+ */
+void ArenaReiniciar(arena_t arena);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARENA_H_ */
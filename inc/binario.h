@@ -0,0 +1,155 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef BINARIO_H_
+#define BINARIO_H_
+
+/** @file binario.h
+ ** @brief declaración del módulo de archivos binarios de alumnos que se leen sin copiarlos
+ **
+ ** Un archivo binario empieza con una cabecera con firma, versión, cantidad de alumnos y la posición de cada
+ ** sección. Le siguen los registros de ancho fijo, uno por alumno, un índice opcional de documentos ordenados y por
+ ** último los textos de los nombres y apellidos, cada uno terminado en '\0'. Todos los números se guardan en el orden de bytes
+ ** del procesador que escribió el archivo, que queda indicado en la cabecera.
+ **
+ ** El lector proyecta el archivo en memoria con mmap y entrega los registros y los textos en el mismo lugar donde
+ ** están, sin copiarlos ni interpretarlos, de modo que abrir un archivo de un millón de alumnos no depende de su
+ ** tamaño. Un archivo abierto puede consultarse desde varios hilos a la vez.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "alumno.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define BINARIO_VERSION 2 //!< versión del formato que escribe y acepta este módulo
+
+#define BINARIO_NINGUNO SIZE_MAX //!< fila que se informa cuando no se encuentra un documento
+
+/* === Public data type declarations =============================================================================== */
+
+//! Registro de ancho fijo de un alumno, tal como está guardado en el archivo
+typedef struct binario_registro_s {
+    uint32_t documento;      //!< documento del alumno
+    uint32_t nombre;         //!< posición del nombre en la sección de textos
+    uint32_t apellido;       //!< posición del apellido en la sección de textos
+    uint16_t largo_nombre;   //!< cantidad de caracteres del nombre, sin el '\0'
+    uint16_t largo_apellido; //!< cantidad de caracteres del apellido, sin el '\0'
+} binario_registro_t;
+
+//! Referencia a un archivo binario abierto para lectura
+typedef struct binario_s * binario_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Escribe un archivo binario con los datos de muchos alumnos.
+ *
+ * @param alumnos Arreglo de referencias a los alumnos a guardar.
+ * @param cantidad Cantidad de alumnos del arreglo.
+ * @param indexar Si es true se agrega el índice de documentos, que permite buscar por documento en tiempo
+ *        logarítmico.
+ * @param descriptor Descriptor del archivo donde se escribe, desde su posición actual.
+ * @return 0 si se escribió el archivo completo, o -1 si hubo un error, en cuyo caso puede haberse escrito una parte.
+ */
+int BinarioEscribir(alumno_t alumnos[], size_t cantidad, bool indexar, int descriptor);
+
+/**
+ * @brief Abre un archivo binario proyectándolo en memoria.
+ *
+ * Solo se verifica la cabecera, por lo que el tiempo de apertura no depende de la cantidad de alumnos.
+ *
+ * @param descriptor Descriptor del archivo a leer. Puede cerrarse después de abrir el archivo.
+ * @return Referencia al archivo abierto, o NULL si no es un archivo binario válido de esta versión y de este orden
+ *         de bytes, o no se pudo proyectar.
+ */
+binario_t BinarioAbrir(int descriptor);
+
+/**
+ * @brief Cierra un archivo binario. Los registros y textos obtenidos del archivo dejan de ser válidos.
+ *
+ * @param binario Archivo a cerrar. Si es NULL no se hace nada.
+ */
+void BinarioCerrar(binario_t binario);
+
+/**
+ * @brief Informa la cantidad de alumnos guardados en un archivo.
+ *
+ * @param binario Archivo a consultar.
+ * @return Cantidad de registros.
+ */
+size_t BinarioCantidad(binario_t binario);
+
+/**
+ * @brief Entrega los registros del archivo en el lugar donde están proyectados.
+ *
+ * @param binario Archivo a consultar.
+ * @return Arreglo de BinarioCantidad() registros, válido hasta que se cierre el archivo.
+ */
+const binario_registro_t * BinarioRegistros(binario_t binario);
+
+/**
+ * @brief Consulta el nombre de un registro.
+ *
+ * @param binario Archivo a consultar.
+ * @param fila Fila entre 0 y BinarioCantidad() - 1.
+ * @return Nombre terminado en '\0', válido hasta que se cierre el archivo, o "" si el registro está dañado.
+ */
+const char * BinarioNombre(binario_t binario, size_t fila);
+
+/**
+ * @brief Consulta el apellido de un registro.
+ *
+ * @param binario Archivo a consultar.
+ * @param fila Fila entre 0 y BinarioCantidad() - 1.
+ * @return Apellido terminado en '\0', válido hasta que se cierre el archivo, o "" si el registro está dañado.
+ */
+const char * BinarioApellido(binario_t binario, size_t fila);
+
+/**
+ * @brief Busca la fila de un documento.
+ *
+ * Si el archivo tiene índice la búsqueda es binaria, sino se recorren los registros.
+ *
+ * @param binario Archivo a consultar.
+ * @param documento Documento a buscar.
+ * @return Primera fila con ese documento, o BINARIO_NINGUNO si no está.
+ */
+size_t BinarioBuscarPorDocumento(binario_t binario, uint32_t documento);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BINARIO_H_ */
@@ -0,0 +1,128 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CACHE_H_
+#define CACHE_H_
+
+/** @file cache.h
+ ** @brief declaración del módulo de memoria de resultados con reemplazo del menos usado recientemente (LRU)
+ **
+ ** La memoria asocia una clave de bytes a un resultado entero. Tiene una cantidad fija de entradas; cuando está
+ ** llena, guardar una clave nueva reemplaza la que hace más tiempo que no se consulta. Todas las funciones se pueden
+ ** llamar desde varios hilos a la vez; como cada consulta actualiza el orden de uso, todas toman el mismo cerrojo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define CACHE_CLAVE_MAX 48 //!< longitud máxima de las claves que se pueden guardar
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a una memoria de resultados
+typedef struct cache_s * cache_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Calcula el tamaño del bloque que necesita una memoria de resultados.
+ *
+ * @param capacidad Cantidad máxima de entradas.
+ * @return Cantidad de bytes a reservar para CacheIniciar, o 0 si la capacidad no es válida.
+ */
+size_t CacheTamano(size_t capacidad);
+
+/**
+ * @brief Crea una memoria de resultados vacía en un bloque reservado por quien llama.
+ *
+ * @param memoria Bloque de al menos CacheTamano(capacidad) bytes, alineado para cualquier tipo de dato.
+ * @param capacidad Cantidad máxima de entradas, al menos una.
+ * @return Referencia a la nueva memoria, que ocupa el bloque recibido, o NULL si algún parámetro no es válido.
+ */
+cache_t CacheIniciar(void * memoria, size_t capacidad);
+
+/**
+ * @brief Libera los recursos de una memoria creada con CacheIniciar, sin liberar su bloque.
+ *
+ * @param cache Memoria a finalizar. Si es NULL no se hace nada.
+ */
+void CacheFinalizar(cache_t cache);
+
+/**
+ * @brief Busca el resultado guardado para una clave y la marca como la usada más recientemente.
+ *
+ * @param cache Memoria de resultados.
+ * @param clave Bytes de la clave.
+ * @param longitud Cantidad de bytes de la clave.
+ * @param resultado Variable donde se guarda el resultado si la clave está presente.
+ * @param generacion Variable donde se guarda la generación actual, para pasarla luego a CacheGuardar.
+ * @return true si la clave estaba guardada, false en caso contrario.
+ */
+bool CacheBuscar(cache_t cache, const char * clave, size_t longitud, int * resultado, uint64_t * generacion);
+
+/**
+ * @brief Guarda el resultado de una clave, reemplazando la entrada menos usada si la memoria está llena.
+ *
+ * El resultado se descarta si la memoria se vació después de la búsqueda que devolvió la generación indicada, ya
+ * que pudo calcularse con datos que ya no son válidos. Las claves más largas que CACHE_CLAVE_MAX no se guardan.
+ *
+ * @param cache Memoria de resultados.
+ * @param clave Bytes de la clave.
+ * @param longitud Cantidad de bytes de la clave.
+ * @param resultado Resultado a guardar.
+ * @param generacion Generación obtenida con CacheBuscar antes de calcular el resultado.
+ */
+void CacheGuardar(cache_t cache, const char * clave, size_t longitud, int resultado, uint64_t generacion);
+
+/**
+ * @brief Descarta todas las entradas de la memoria y comienza una nueva generación.
+ *
+ * @param cache Memoria de resultados.
+ */
+void CacheVaciar(cache_t cache);
+
+/**
+ * @brief Informa cuántas búsquedas encontraron su clave y cuántas no desde que se creó la memoria.
+ *
+ * @param cache Memoria de resultados.
+ * @param aciertos Variable donde se guarda la cantidad de búsquedas exitosas, puede ser NULL.
+ * @param fallos Variable donde se guarda la cantidad de búsquedas fallidas, puede ser NULL.
+ */
+void CacheEstadisticas(cache_t cache, uint64_t * aciertos, uint64_t * fallos);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CACHE_H_ */
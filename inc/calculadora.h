@@ -30,6 +30,12 @@ SPDX-License-Identifier: MIT
  ** como por ejemplo `"5+4"`, `"7*3"` o `"10-8"`.
  **
  ** La implementación sigue el patrón estrategia, permitiendo extender fácilmente con nuevas operaciones.
+ **
+ ** Una misma calculadora puede usarse desde varios hilos a la vez: las funciones de evaluación no toman bloqueos y
+ ** pueden ejecutarse mientras otro hilo registra operaciones o compila expresiones. Cada evaluación usa el conjunto
+ ** de operaciones vigente al comenzar. La excepción es la memoria de resultados de CalculadoraCacheHabilitar: mientras
+ ** está habilitada, CalculadoraCalcula, CalculadoraCalculaTexto, CalculadoraCalculaEstado y CalculadoraCalculaLote
+ ** toman su cerrojo para consultarla y para guardar cada resultado nuevo.
  **/
 
 #ifndef CALCULADORA_H_
@@ -41,7 +47,10 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ====================================================================================*/
 
+#include "arena.h"
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /* === Header for C++ compatibility ================================================================================*/
 
@@ -51,6 +60,8 @@ extern "C" {
 
 /* === Public macros definitions ===================================================================================*/
 
+#define CALCULADORA_PILA_MAX 64 //!< máxima profundidad de anidamiento y de pila de evaluación de una expresión
+
 /* === Public data type declarations===============================================================================*/
 
 
@@ -58,6 +69,35 @@ typedef struct calculadora_s * calculadora_t; //<! tipo de dato para el objeto c
 
 typedef int (*operacion_func_t)(int, int); //<! tipo de dato para las funciones de operaciones
 
+typedef struct programa_s * programa_t; //<! tipo de dato para una expresión compilada por la calculadora
+
+//! Función que traduce el nombre de un parámetro a su índice en los valores de evaluación, o -1 si no lo conoce
+typedef int (*calculadora_resolver_t)(void * contexto, const char * nombre, size_t longitud);
+
+//! Asociatividad de un operador binario
+typedef enum asociatividad_e {
+    CALCULADORA_IZQUIERDA, //!< "a op b op c" se evalúa como "(a op b) op c"
+    CALCULADORA_DERECHA,   //!< "a op b op c" se evalúa como "a op (b op c)"
+} asociatividad_t;
+
+//! Atributos con los que se registra una operación
+typedef struct operacion_atributos_s {
+    int precedencia;               //!< precedencia del operador, un valor mayor se evalúa antes
+    asociatividad_t asociatividad; //!< asociatividad sintáctica del operador en las expresiones
+    bool asociativa;               //!< la operación cumple (a op b) op c == a op (b op c)
+    bool conmutativa;              //!< la operación cumple a op b == b op a
+} operacion_atributos_t;
+
+//! Resultado de la evaluación de una expresión
+typedef enum calculadora_estado_e {
+    CALCULADORA_CORRECTO,             //!< la expresión se evaluó sin errores
+    CALCULADORA_DIVISION_POR_CERO,    //!< la expresión divide por cero
+    CALCULADORA_OPERADOR_DESCONOCIDO, //!< la expresión usa un operador que no está registrado
+    CALCULADORA_EXPRESION_INVALIDA,   //!< la expresión está mal formada, es demasiado profunda o le faltan valores
+    CALCULADORA_DESBORDAMIENTO,       //!< un número o un resultado intermedio no entra en un int
+    CALCULADORA_ESTADOS,              //!< cantidad de estados posibles
+} calculadora_estado_t;
+
 /* === Public variable declarations ================================================================================*/
 
 /* === Public function declarations ================================================================================*/
@@ -65,11 +105,40 @@ typedef int (*operacion_func_t)(int, int); //<! tipo de dato para las funciones
 /**
  * @brief Crea un nuevo objeto calculadora.
  *
+ * Si CALCULADORA_MEMORIA_ESTATICA_ACTIVA vale 1 en config.h, la calculadora ocupa uno de los CALCULADORA_MAX
+ * bloques estáticos de CALCULADORA_MEMORIA bytes y nunca se usa malloc para ella, sus operaciones, sus programas ni
+ * su memoria de resultados.
+ *
  * @return Objeto calculadora válido o NULL en caso de error.
  */
 
 calculadora_t CalculadoraCrear(void);
 
+/**
+ * @brief Crea un nuevo objeto calculadora cuya memoria se asigna toda de una arena.
+ *
+ * La calculadora, su tabla de operaciones, cada operación registrada, los programas compilados y la memoria de
+ * resultados se asignan de la arena. La tabla ocupa unos 2 KB y cada operación unos 24 bytes más, de modo que una
+ * arena de 16 KB alcanza para registrar todos los operadores posibles. CalculadoraDestruir solo libera los recursos
+ * del sistema; la memoria se recupera de una vez con ArenaReiniciar.
+ *
+ * Las funciones que evalúan texto, como CalculadoraCalcula, no piden memoria para ninguna longitud de expresión;
+ * CalculadoraCompilar asigna de la arena el programa que devuelve.
+ *
+ * @param arena Arena creada con ArenaCrear sobre un bloque provisto por quien llama.
+ * @return Objeto calculadora válido o NULL si la arena no tiene espacio suficiente.
+ */
+
+calculadora_t CalculadoraCrearEnArena(arena_t arena);
+
+/**
+ * @brief Destruye un objeto calculadora liberando también todas sus operaciones.
+ *
+ * @param calculator Objeto calculadora a destruir. Si es NULL no se hace nada.
+ */
+
+void CalculadoraDestruir(calculadora_t calculator);
+
 /**
  * @brief Agrega una nueva operación a la calculadora.
  *
@@ -82,7 +151,27 @@ calculadora_t CalculadoraCrear(void);
 bool CalculadoraAddOperacion(calculadora_t calculator, char sumador, operacion_func_t funcion);
 
 /**
- * @brief Evalúa una expresión matemática simple (como "3+5").
+ * @brief Agrega una nueva operación a la calculadora indicando su precedencia y asociatividad.
+ *
+ * CalculadoraAddOperacion registra las operaciones asociativas a izquierda, con precedencia 2 para OperacionMul y
+ * OperacionDiv y precedencia 1 para las demás, y marca OperacionAdd y OperacionMul como asociativas y conmutativas.
+ * Los caracteres '(', ')', los dígitos y los espacios están reservados.
+ *
+ * @param calculator Objeto calculadora al que se le agregará la operación.
+ * @param operador Carácter que representa la operación.
+ * @param funcion Función que implementa la operación.
+ * @param atributos Precedencia, asociatividad y propiedades algebraicas del operador.
+ * @return true si la operación fue agregada con éxito, false en caso contrario (ya existe, reservado o error).
+ */
+
+bool CalculadoraAddOperacionAtributos(calculadora_t calculator, char operador, operacion_func_t funcion,
+                                      const operacion_atributos_t * atributos);
+
+/**
+ * @brief Evalúa una expresión matemática (como "3+5" o "-2 + 3*(4-1)").
+ *
+ * Se respetan la precedencia y la asociatividad de cada operación; se admiten espacios, paréntesis y el signo menos
+ * unario.
  *
  * @param calculator Objeto calculadora con las operaciones definidas.
  * @param expresion Cadena con la expresión a evaluar (debe tener formato válido).
@@ -91,6 +180,214 @@ bool CalculadoraAddOperacion(calculadora_t calculator, char sumador, operacion_f
 
 int CalculadoraCalcula(calculadora_t calculator, const char * expresion);
 
+/**
+ * @brief Evalúa una expresión matemática delimitada por su longitud en lugar de un '\0' final.
+ *
+ * Permite evaluar expresiones dentro de un buffer más grande, por ejemplo una línea de un archivo, sin copiarlas.
+ * Para distinguir un error de un resultado igual a 0 debe usarse CalculadoraCalculaEstado.
+ *
+ * @param calculator Objeto calculadora con las operaciones definidas.
+ * @param expresion Texto de la expresión a evaluar.
+ * @param longitud Cantidad de caracteres de la expresión.
+ * @return Resultado del cálculo. Si hay error, devuelve 0.
+ */
+
+int CalculadoraCalculaTexto(calculadora_t calculator, const char * expresion, size_t longitud);
+
+/**
+ * @brief Evalúa una expresión matemática informando si hubo un error y de qué tipo.
+ *
+ * Las sumas, restas, multiplicaciones, divisiones y cambios de signo de OperacionAdd, OperacionSub, OperacionMul y
+ * OperacionDiv se controlan contra desbordamiento y división por cero; las demás operaciones se aplican tal como
+ * devuelven su resultado. Los errores no escriben mensajes: se cuentan y pueden consultarse con
+ * CalculadoraErrores.
+ *
+ * @param calculator Objeto calculadora con las operaciones definidas.
+ * @param expresion Texto de la expresión a evaluar.
+ * @param longitud Cantidad de caracteres de la expresión.
+ * @param resultado Variable donde se guarda el resultado, o 0 si hay error. Puede ser NULL.
+ * @return CALCULADORA_CORRECTO si la expresión se evaluó, o el estado que describe el error.
+ */
+
+calculadora_estado_t CalculadoraCalculaEstado(calculadora_t calculator, const char * expresion, size_t longitud,
+                                              int * resultado);
+
+/**
+ * @brief Evalúa un lote de expresiones repartiéndolas entre todos los núcleos disponibles.
+ *
+ * Los resultados son los mismos que se obtendrían llamando a CalculadoraCalcula con cada expresión.
+ *
+ * @param calculator Objeto calculadora con las operaciones definidas.
+ * @param expresiones Arreglo de expresiones a evaluar.
+ * @param resultados Arreglo donde se guarda el resultado de cada expresión, del mismo largo que expresiones.
+ * @param n Cantidad de expresiones.
+ * @return true si el lote fue evaluado, false si algún parámetro es inválido.
+ */
+
+bool CalculadoraCalculaLote(calculadora_t calculator, const char * expresiones[], int resultados[], size_t n);
+
+/**
+ * @brief Habilita, redimensiona o deshabilita la memoria de resultados de la calculadora.
+ *
+ * Con la memoria habilitada, las expresiones que se repiten se responden sin volver a compilarlas ni evaluarlas,
+ * recordando las últimas `capacidad` expresiones usadas de hasta CACHE_CLAVE_MAX caracteres (ver cache.h). La
+ * memoria se vacía cada vez que se agrega una operación. Supone que las funciones de las operaciones siempre dan el
+ * mismo resultado para los mismos operandos. No debe llamarse mientras otros hilos usan la calculadora.
+ *
+ * Cada consulta reordena la lista de uso de la memoria, así que las consultas y los guardados se hacen con un
+ * cerrojo: los hilos que evalúan a la vez con la misma calculadora se esperan entre sí. Cuando muchos hilos
+ * comparten una calculadora y las expresiones rara vez se repiten conviene dejar la memoria deshabilitada.
+ *
+ * @param calculator Objeto calculadora a configurar.
+ * @param capacidad Cantidad máxima de expresiones a recordar, o 0 para deshabilitar la memoria.
+ * @return true si la configuración fue aplicada, false si hubo un error.
+ */
+
+bool CalculadoraCacheHabilitar(calculadora_t calculator, size_t capacidad);
+
+/**
+ * @brief Informa los aciertos y fallos de la memoria de resultados desde que se habilitó.
+ *
+ * @param calculator Objeto calculadora a consultar.
+ * @param aciertos Variable donde se guarda la cantidad de expresiones respondidas desde la memoria, puede ser NULL.
+ * @param fallos Variable donde se guarda la cantidad de expresiones que hubo que calcular, puede ser NULL.
+ * @return true si la memoria de resultados está habilitada, false en caso contrario.
+ */
+
+bool CalculadoraCacheEstadisticas(calculadora_t calculator, uint64_t * aciertos, uint64_t * fallos);
+
+/**
+ * @brief Aplica una operación registrada a dos arreglos elemento a elemento: salida[i] = a[i] op b[i].
+ *
+ * Para OperacionAdd, OperacionSub, OperacionMul y OperacionDiv se usan implementaciones SIMD elegidas según el
+ * procesador; en ese modo la división por cero da 0 sin mensajes. Las demás operaciones se aplican elemento por
+ * elemento llamando a su función.
+ *
+ * @param calculator Objeto calculadora con las operaciones definidas.
+ * @param operador Carácter de la operación a aplicar.
+ * @param a Arreglo con los primeros operandos.
+ * @param b Arreglo con los segundos operandos.
+ * @param salida Arreglo donde se guardan los resultados, puede coincidir con a o con b.
+ * @param n Cantidad de elementos de los arreglos.
+ * @return true si la operación fue aplicada, false si el operador no está registrado o hubo un error.
+ */
+
+bool CalculadoraAplicarVector(calculadora_t calculator, char operador, const int a[], const int b[], int salida[],
+                              size_t n);
+
+/**
+ * @brief Reduce un arreglo a un único valor: valores[0] op valores[1] op ... op valores[n-1], de izquierda a derecha.
+ *
+ * Si la operación fue registrada como asociativa, la reducción se reparte entre varios hilos y se combina en forma
+ * de árbol; si además es una de las operaciones incluidas y conmutativa, cada porción se reduce con SIMD. Las demás
+ * operaciones se pliegan en forma secuencial.
+ *
+ * @param calculator Objeto calculadora con las operaciones definidas.
+ * @param operador Carácter de la operación con la que se reduce.
+ * @param valores Arreglo a reducir.
+ * @param n Cantidad de elementos del arreglo.
+ * @return Resultado de la reducción. Si el arreglo está vacío o hay error, devuelve 0.
+ */
+
+int CalculadoraReducir(calculadora_t calculator, char operador, const int valores[], size_t n);
+
+/**
+ * @brief Compila una expresión para evaluarla muchas veces con distintos valores.
+ *
+ * Además de números, los operandos pueden ser parámetros escritos como letras minúsculas de la 'a' a la 'z'
+ * (siempre que la letra no esté registrada como operador). El texto se analiza una sola vez; el programa
+ * resultante pertenece a la calculadora y se libera con CalculadoraDestruir o CalculadoraLiberarPrograma.
+ *
+ * @param calculator Objeto calculadora con las operaciones definidas.
+ * @param expresion Cadena con la expresión a compilar (por ejemplo "a*3" o "a+b").
+ * @return Programa compilado, o NULL si la expresión es inválida o hubo un error.
+ */
+
+programa_t CalculadoraCompilar(calculadora_t calculator, const char * expresion);
+
+/**
+ * @brief Compila una expresión cuyos parámetros se escriben con nombres de varios caracteres.
+ *
+ * Los nombres empiezan con una letra o '_' y siguen con letras, dígitos o '_' que no estén registrados como
+ * operadores. Cada nombre se traduce con el resolver al índice del valor que recibirá en CalculadoraEvaluar; un
+ * mismo nombre puede aparecer varias veces. Sin resolver, se comporta como CalculadoraCompilar.
+ *
+ * @param calculator Objeto calculadora con las operaciones definidas.
+ * @param expresion Cadena con la expresión a compilar (por ejemplo "precio * cantidad + envio").
+ * @param resolver Función que traduce los nombres, o NULL.
+ * @param contexto Puntero que se pasa sin cambios al resolver.
+ * @param estado Variable donde se guarda el resultado de la compilación, puede ser NULL.
+ * @return Programa compilado, o NULL si la expresión es inválida, el resolver no conoce un nombre o hubo un error.
+ */
+
+programa_t CalculadoraCompilarNombres(calculadora_t calculator, const char * expresion, calculadora_resolver_t resolver,
+                                      void * contexto, calculadora_estado_t * estado);
+
+/**
+ * @brief Libera un programa que ya no se va a evaluar, sin esperar a destruir la calculadora.
+ *
+ * En una calculadora creada en una arena la memoria del programa se recupera recién al reiniciar la arena. No debe
+ * llamarse mientras otro hilo evalúa el programa.
+ *
+ * @param calculator Objeto calculadora que compiló el programa.
+ * @param programa Programa a liberar. Si es NULL no se hace nada.
+ */
+
+void CalculadoraLiberarPrograma(calculadora_t calculator, programa_t programa);
+
+/**
+ * @brief Evalúa una expresión compilada sin volver a analizar su texto.
+ *
+ * @param calculator Objeto calculadora que compiló el programa.
+ * @param programa Programa obtenido con CalculadoraCompilar.
+ * @param valores Valores de los parámetros: valores[0] para 'a', valores[1] para 'b', etc.
+ * @return Resultado del cálculo. Si hay error, devuelve 0.
+ */
+
+int CalculadoraEvaluar(calculadora_t calculator, programa_t programa, const int valores[]);
+
+/**
+ * @brief Evalúa una expresión compilada informando si hubo un error y de qué tipo.
+ *
+ * @param calculator Objeto calculadora que compiló el programa.
+ * @param programa Programa obtenido con CalculadoraCompilar.
+ * @param valores Valores de los parámetros: valores[0] para 'a', valores[1] para 'b', etc.
+ * @param resultado Variable donde se guarda el resultado, o 0 si hay error. Puede ser NULL.
+ * @return CALCULADORA_CORRECTO si el programa se evaluó, o el estado que describe el error.
+ */
+
+calculadora_estado_t CalculadoraEvaluarEstado(calculadora_t calculator, programa_t programa, const int valores[],
+                                              int * resultado);
+
+/**
+ * @brief Informa cuántos errores de cada tipo encontró la calculadora desde que se creó.
+ *
+ * Se cuentan los errores de todas las funciones que evalúan o compilan expresiones, desde cualquier hilo.
+ *
+ * @param calculator Objeto calculadora a consultar.
+ * @param errores Arreglo donde se guarda la cantidad de errores de cada estado; errores[CALCULADORA_CORRECTO]
+ *        siempre vale 0.
+ * @return true si se leyeron los contadores, false si algún parámetro es inválido.
+ */
+
+bool CalculadoraErrores(calculadora_t calculator, uint64_t errores[CALCULADORA_ESTADOS]);
+
+/**
+ * @brief Escribe en formato JSON las mediciones de uso de la calculadora.
+ *
+ * Solo está disponible si INSTRUMENTACION_ACTIVA vale 1 en config.h; en ese caso cada hilo cuenta en sus propios
+ * contadores las veces que se aplicó y que falló cada operador, y la duración de cada llamada a
+ * CalculadoraCalculaEstado (y por lo tanto a CalculadoraCalcula) en un histograma de potencias de dos. Con la
+ * instrumentación deshabilitada no se mide nada y esta función siempre falla.
+ *
+ * @param calculator Objeto calculadora a consultar.
+ * @param buffer Buffer donde se escribe el texto, terminado en '\0'.
+ * @param size Tamaño del buffer.
+ * @return Cantidad de caracteres escritos, o -1 si el buffer no alcanza o la instrumentación está deshabilitada.
+ */
+
+int CalculadoraSerializarMediciones(calculadora_t calculator, char buffer[], size_t size);
+
 /**
  * @brief Función para realizar una suma.
  *
@@ -127,7 +424,8 @@ int OperacionMul (int a, int b);
  *
  * @param a Dividendo.
  * @param b Divisor.
- * @return Resultado de a / b. Si b es 0, el comportamiento es indefinido.
+ * @return Resultado de a / b. Si b es 0 devuelve 0 y si el cociente no entra en un int devuelve INT_MIN, sin
+ *         informar el error; CalculadoraCalculaEstado sí lo informa.
  */
 
 int OperacionDiv (int a, int b);
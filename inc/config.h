@@ -38,7 +38,22 @@ extern "C" {
 #define USAR_MEMORIA_ESTATICA 
 #endif
 #ifdef USAR_MEMORIA_ESTATICA
-#define ALUMNO_MAX 2 //!< cantidad maxima de alumnos
+#define ALUMNO_MAX 2 //!< cantidad maxima de alumnos, puede ir de 2 a varios millones
+#define TEXTOS_MEMORIA (ALUMNO_MAX * 64 + 8192) //!< bytes de nombres, 64 por alumno y 4 del largo máximo
+#else
+#define ALUMNO_BLOQUE 1024 //!< cantidad de alumnos que se reservan juntos cada vez que se agotan las instancias
+#endif
+#define CALCULADORA_MEMORIA_ESTATICA_ACTIVA 0 //!< si el valor es 1 las calculadoras usaran memoria estatica
+#if (CALCULADORA_MEMORIA_ESTATICA_ACTIVA) == 1
+#define CALCULADORA_USAR_MEMORIA_ESTATICA
+#endif
+#ifdef CALCULADORA_USAR_MEMORIA_ESTATICA
+#define CALCULADORA_MAX 2 //!< cantidad maxima de calculadoras
+#define CALCULADORA_MEMORIA 65536 //!< bytes de cada calculadora, alcanzan para todos los operadores posibles
+#endif
+#define INSTRUMENTACION_ACTIVA 0 //!< si el valor es 1 la calculadora cuenta llamadas, errores y latencias
+#if (INSTRUMENTACION_ACTIVA) == 1
+#define USAR_INSTRUMENTACION
 #endif
 
 /* === Public data type declarations =============================================================================== */
@@ -0,0 +1,86 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CONVERSION_H_
+#define CONVERSION_H_
+
+/** @file conversion.h
+ ** @brief declaración del módulo de conversión rápida entre enteros y texto decimal
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define CONVERSION_ENTERO_MAX 11 //!< caracteres máximos que ocupa un int en decimal, incluido el signo
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Escribe un entero en decimal, de a dos dígitos por paso y sin pasar por printf.
+ *
+ * @param valor Entero a convertir.
+ * @param destino Buffer donde se escriben los caracteres, con lugar para CONVERSION_ENTERO_MAX. No se agrega '\0'.
+ * @return Cantidad de caracteres escritos.
+ */
+size_t ConversionEnteroATexto(int valor, char destino[]);
+
+/**
+ * @brief Escribe un entero sin signo en decimal, directamente en su posición final y sin pasar por printf.
+ *
+ * @param valor Entero a convertir.
+ * @param destino Buffer donde se escriben los caracteres, con lugar para CONVERSION_ENTERO_MAX - 1. No se agrega
+ *        '\0'.
+ * @return Cantidad de caracteres escritos.
+ */
+size_t ConversionSinSignoATexto(uint32_t valor, char destino[]);
+
+/**
+ * @brief Lee un entero decimal con signo opcional, de a ocho dígitos por paso cuando el texto lo permite.
+ *
+ * Los dígitos se reconocen y se combinan dentro de un registro de 64 bits (SWAR), sin depender de un '\0' final,
+ * de modo que quien llama puede seguir analizando el texto desde la posición devuelta.
+ *
+ * @param texto Posición donde comienza el número, opcionalmente con un signo '+' o '-'.
+ * @param fin Posición siguiente al último carácter que se puede leer.
+ * @param valor Variable donde se guarda el número leído.
+ * @return Posición siguiente al último dígito, o NULL si no hay dígitos o el número no entra en un int.
+ */
+const char * ConversionTextoAEntero(const char * texto, const char * fin, int * valor);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONVERSION_H_ */
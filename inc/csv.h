@@ -0,0 +1,88 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CSV_H_
+#define CSV_H_
+
+/** @file csv.h
+ ** @brief declaración del módulo de importación y exportación de alumnos en archivos CSV
+ **
+ ** Cada fila de un archivo CSV tiene tres campos separados por comas: nombre, apellido y documento. Los campos que
+ ** contienen comas, comillas o saltos de línea van entre comillas dobles, y las comillas dentro de ellos se escriben
+ ** duplicadas. La primera fila puede ser la cabecera "nombre,apellido,documento", que se escribe siempre y se saltea
+ ** al leer. Las filas pueden terminar en "\n" o en "\r\n".
+ **
+ ** La lectura proyecta el archivo con mmap cuando es un archivo común y lo lee de a tramos grandes en otro caso. Los
+ ** campos se reconocen en el mismo lugar donde están, sin copiar la fila; solo el nombre y el apellido se copian para
+ ** crear cada alumno con AlumnoCrear.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "alumno.h"
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Escribe un arreglo de alumnos como archivo CSV, con la fila de cabecera.
+ *
+ * Las filas se arman directamente en un buffer grande, que se escribe cada vez que se llena.
+ *
+ * @param alumnos Alumnos a escribir, en orden.
+ * @param cantidad Cantidad de alumnos.
+ * @param descriptor Descriptor de archivo abierto para escritura.
+ * @return 0 si se escribieron todos los alumnos, -1 si algún alumno es NULL, no hay memoria o hubo un error de
+ *         escritura.
+ */
+int CsvEscribir(alumno_t alumnos[], size_t cantidad, int descriptor);
+
+/**
+ * @brief Crea un alumno por cada fila de un archivo CSV.
+ *
+ * @param descriptor Descriptor del archivo o tubería del que se lee. Los archivos comunes se leen completos desde el
+ *        comienzo.
+ * @param alumnos Arreglo donde se guardan las referencias a los alumnos creados, en el orden del archivo.
+ * @param capacidad Cantidad de referencias que entran en el arreglo.
+ * @return Cantidad de alumnos creados, o -1 si alguna fila no tiene el formato esperado, hay más alumnos que
+ *         capacidad, no se pudo crear un alumno o hubo un error de lectura; en ese caso se destruyen los alumnos que
+ *         se habían creado.
+ */
+int CsvLeer(int descriptor, alumno_t alumnos[], size_t capacidad);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSV_H_ */
@@ -0,0 +1,142 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef ESCRITOR_H_
+#define ESCRITOR_H_
+
+/** @file escritor.h
+ ** @brief declaración del módulo de buffers de salida que crecen a medida que se escribe en ellos
+ **
+ ** Un escritor acumula caracteres en un buffer propio que se agranda al doble cuando hace falta y que conserva su
+ ** memoria al vaciarlo. Quien serializa muchos registros seguidos reutiliza el mismo escritor, de modo que después de
+ ** los primeros registros ya no se reserva memoria, y consulta el tamaño exacto de cada registro antes de escribirlo
+ ** para no tener que reintentar con un buffer más grande.
+ **
+ ** Un escritor no debe usarse desde varios hilos a la vez.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a un escritor
+typedef struct escritor_s * escritor_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un escritor vacío.
+ *
+ * @param capacidad Cantidad de caracteres que se espera escribir, para reservar la memoria de una vez. Puede ser 0.
+ * @return Referencia al escritor, o NULL si no hay memoria.
+ */
+escritor_t EscritorCrear(size_t capacidad);
+
+/**
+ * @brief Destruye un escritor y libera su buffer.
+ *
+ * @param escritor Escritor a destruir, puede ser NULL.
+ */
+void EscritorDestruir(escritor_t escritor);
+
+/**
+ * @brief Reserva lugar al final del buffer para escribir directamente en él.
+ *
+ * Los caracteres escritos pasan a formar parte del contenido recién al llamar a EscritorAvanzar. El puntero deja de
+ * ser válido en la siguiente operación que pueda agrandar el buffer.
+ *
+ * @param escritor Escritor donde se reserva el lugar.
+ * @param cantidad Cantidad de caracteres a escribir; además se garantiza lugar para un '\0' a continuación.
+ * @return Puntero donde se escriben los caracteres, o NULL si no hay memoria.
+ */
+char * EscritorReservar(escritor_t escritor, size_t cantidad);
+
+/**
+ * @brief Agrega al contenido los caracteres escritos en el lugar obtenido con EscritorReservar.
+ *
+ * @param escritor Escritor a actualizar.
+ * @param cantidad Cantidad de caracteres escritos, a lo sumo la reservada.
+ */
+void EscritorAvanzar(escritor_t escritor, size_t cantidad);
+
+/**
+ * @brief Agrega caracteres al final del contenido.
+ *
+ * @param escritor Escritor donde se agregan los caracteres.
+ * @param datos Caracteres a agregar.
+ * @param cantidad Cantidad de caracteres a agregar.
+ * @return true si se agregaron, false si no hay memoria.
+ */
+bool EscritorAgregar(escritor_t escritor, const char datos[], size_t cantidad);
+
+/**
+ * @brief Consulta el contenido acumulado.
+ *
+ * @param escritor Escritor a consultar.
+ * @return Caracteres escritos, válidos hasta la siguiente operación que modifique el escritor. Puede ser NULL si
+ *         todavía no se escribió nada.
+ */
+const char * EscritorDatos(escritor_t escritor);
+
+/**
+ * @brief Consulta la cantidad de caracteres acumulados.
+ *
+ * @param escritor Escritor a consultar.
+ * @return Cantidad de caracteres escritos.
+ */
+size_t EscritorLargo(escritor_t escritor);
+
+/**
+ * @brief Descarta el contenido conservando la memoria reservada, para volver a usar el escritor.
+ *
+ * @param escritor Escritor a vaciar.
+ */
+void EscritorVaciar(escritor_t escritor);
+
+/**
+ * @brief Escribe todo el contenido en un descriptor de archivo y vacía el escritor.
+ *
+ * @param escritor Escritor a volcar.
+ * @param descriptor Descriptor de archivo abierto para escritura.
+ * @return 0 si se escribió todo el contenido, -1 si hubo un error de escritura; en ese caso el contenido pudo quedar
+ *         escrito en parte y el escritor no se vacía.
+ */
+int EscritorVolcar(escritor_t escritor, int descriptor);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ESCRITOR_H_ */
@@ -0,0 +1,77 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef FLUJO_H_
+#define FLUJO_H_
+
+/** @file flujo.h
+ ** @brief declaración del módulo para evaluar flujos de expresiones separadas por líneas
+ **
+ ** Las expresiones se leen de un descriptor de archivo, una por línea, y los resultados se escriben en otro
+ ** descriptor, también uno por línea y en el mismo orden. Los archivos regulares se mapean en memoria y el resto de
+ ** las entradas (tuberías, terminales) se leen en bloques grandes; en ambos casos las líneas se evalúan en el lugar,
+ ** sin copiarlas, y la salida se acumula en un buffer grande antes de escribirse.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calculadora.h"
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define FLUJO_LECTURA (1u << 20) //!< tamaño de cada bloque leído cuando la entrada no se puede mapear en memoria
+
+#define FLUJO_ESCRITURA (1u << 20) //!< tamaño del buffer donde se acumulan los resultados antes de escribirlos
+
+#define FLUJO_ERROR "error" //!< texto que se escribe en lugar del resultado de una expresión que no se pudo evaluar
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Evalúa todas las expresiones de una entrada y escribe sus resultados en una salida.
+ *
+ * Cada línea de la entrada es una expresión; se admiten finales de línea "\n" y "\r\n". Por cada línea se escribe el
+ * resultado de CalculadoraCalculaEstado en decimal seguido de "\n", o FLUJO_ERROR seguido de "\n" si la expresión
+ * tiene un error, para que no se confunda con un resultado igual a 0.
+ *
+ * @param calculadora Calculadora con las operaciones registradas.
+ * @param entrada Descriptor de archivo del que se leen las expresiones.
+ * @param salida Descriptor de archivo en el que se escriben los resultados.
+ * @return true si se procesó toda la entrada, false si hubo un error de lectura, escritura o memoria.
+ */
+bool FlujoEvaluar(calculadora_t calculadora, int entrada, int salida);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLUJO_H_ */
@@ -0,0 +1,128 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef HOJA_H_
+#define HOJA_H_
+
+/** @file hoja.h
+ ** @brief declaración del módulo de hojas de cálculo con variables con nombre y recálculo incremental
+ **
+ ** Una hoja guarda celdas con nombre. Cada celda es un valor de entrada o una fórmula que se calcula a partir de
+ ** otras celdas, por ejemplo "total = precio * cantidad + envio". La hoja mantiene el grafo de dependencias entre
+ ** celdas: cambiar una entrada solo marca como desactualizadas las fórmulas que dependen de ella, y cada fórmula se
+ ** vuelve a evaluar recién cuando se consulta su valor. El costo de un cambio depende de cuántas fórmulas afecta y
+ ** no de cuántas fórmulas tiene la hoja.
+ **
+ ** Una hoja no debe usarse desde varios hilos a la vez.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calculadora.h"
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a una hoja de cálculo
+typedef struct hoja_s * hoja_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una hoja vacía que evalúa sus fórmulas con una calculadora.
+ *
+ * @param calculadora Calculadora con las operaciones que pueden usar las fórmulas. Debe existir mientras exista la
+ *        hoja.
+ * @return Referencia a la nueva hoja, o NULL si no se pudo asignar memoria.
+ */
+hoja_t HojaCrear(calculadora_t calculadora);
+
+/**
+ * @brief Destruye una hoja liberando sus celdas y los programas de sus fórmulas.
+ *
+ * @param hoja Hoja a destruir. Si es NULL no se hace nada.
+ */
+void HojaDestruir(hoja_t hoja);
+
+/**
+ * @brief Asigna un valor de entrada a una celda, creándola si no existe.
+ *
+ * Si la celda tenía una fórmula, la fórmula se descarta. Las fórmulas que dependen de la celda se marcan como
+ * desactualizadas, salvo que el valor no haya cambiado.
+ *
+ * @param hoja Hoja a modificar.
+ * @param nombre Nombre de la celda: una letra o '_' seguida de letras, dígitos o '_'.
+ * @param valor Valor de la celda.
+ * @return true si se asignó el valor, false si el nombre no es válido o no se pudo asignar memoria.
+ */
+bool HojaAsignar(hoja_t hoja, const char * nombre, int valor);
+
+/**
+ * @brief Define la fórmula de una celda con el formato "nombre = expresión".
+ *
+ * La expresión puede nombrar otras celdas; las que todavía no existen se crean como entradas con valor 0. Se
+ * rechazan las fórmulas que harían que una celda dependa de sí misma, directa o indirectamente.
+ *
+ * @param hoja Hoja a modificar.
+ * @param definicion Texto de la definición, por ejemplo "total = a*b + c".
+ * @return CALCULADORA_CORRECTO si se definió la fórmula, o el estado que describe el error; una definición mal
+ *         formada o circular devuelve CALCULADORA_EXPRESION_INVALIDA. Una definición rechazada no modifica ninguna
+ *         fórmula ni crea las celdas que nombra.
+ */
+calculadora_estado_t HojaDefinir(hoja_t hoja, const char * definicion);
+
+/**
+ * @brief Obtiene el valor de una celda, recalculando antes las fórmulas desactualizadas de las que depende.
+ *
+ * Si una fórmula falla al evaluarse, el error se propaga a las fórmulas que dependen de ella.
+ *
+ * @param hoja Hoja a consultar.
+ * @param nombre Nombre de la celda.
+ * @param valor Variable donde se guarda el valor, o 0 si hay error. Puede ser NULL.
+ * @return CALCULADORA_CORRECTO si la celda tiene un valor, o el estado que describe el error;
+ *         CALCULADORA_EXPRESION_INVALIDA si la celda no existe.
+ */
+calculadora_estado_t HojaValor(hoja_t hoja, const char * nombre, int * valor);
+
+/**
+ * @brief Informa cuántas fórmulas se evaluaron desde que se creó la hoja.
+ *
+ * @param hoja Hoja a consultar.
+ * @return Cantidad de evaluaciones de fórmulas.
+ */
+uint64_t HojaEvaluaciones(hoja_t hoja);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOJA_H_ */
@@ -0,0 +1,152 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef MEDICION_H_
+#define MEDICION_H_
+
+/** @file medicion.h
+ ** @brief declaración del módulo de contadores de uso y de latencia por hilo
+ **
+ ** Cada hilo que registra mediciones obtiene su propio bloque de contadores, que solo él modifica; así contar no
+ ** necesita instrucciones atómicas de lectura-modificación-escritura ni comparte líneas de caché con otros hilos. Al
+ ** leer las mediciones se suman los bloques de todos los hilos. Los bloques se conservan hasta destruir la medición,
+ ** por lo que lo contado por un hilo que termina no se pierde.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define MEDICION_OPERADORES 256 //!< cantidad de operadores que se cuentan, uno por carácter
+
+#define MEDICION_CUBETAS 40 //!< cubetas del histograma de latencias, la última acumula las mayores a 2^39 ns
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a un conjunto de mediciones
+typedef struct medicion_s * medicion_t;
+
+//! Referencia a los contadores de un hilo dentro de un conjunto de mediciones
+typedef struct medicion_hilo_s * medicion_hilo_t;
+
+//! Contadores que registra un hilo
+struct medicion_hilo_s {
+    _Atomic uint64_t llamadas[MEDICION_OPERADORES]; //!< veces que se aplicó cada operador
+    _Atomic uint64_t errores[MEDICION_OPERADORES];  //!< veces que falló cada operador
+    _Atomic uint64_t latencias[MEDICION_CUBETAS];   //!< cálculos que tardaron entre 2^i y 2^(i+1) - 1 ns
+    const void * dueno;                             //!< identifica al hilo que modifica los contadores
+    medicion_hilo_t siguiente;                      //!< bloque de otro hilo en la misma medición
+};
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un conjunto de mediciones vacío.
+ *
+ * @return Referencia al nuevo conjunto, o NULL si no se pudo asignar memoria.
+ */
+medicion_t MedicionCrear(void);
+
+/**
+ * @brief Libera un conjunto de mediciones junto con los contadores de todos los hilos.
+ *
+ * @param medicion Conjunto a liberar. Si es NULL no se hace nada.
+ */
+void MedicionDestruir(medicion_t medicion);
+
+/**
+ * @brief Obtiene los contadores del hilo que llama, creándolos la primera vez.
+ *
+ * Cada hilo recuerda los contadores de las últimas mediciones que usó, de modo que normalmente no se recorre la
+ * lista de hilos ni se toman bloqueos.
+ *
+ * @param medicion Conjunto de mediciones.
+ * @return Contadores del hilo, o NULL si no se pudo asignar memoria.
+ */
+medicion_hilo_t MedicionHilo(medicion_t medicion);
+
+/**
+ * @brief Escribe las mediciones de todos los hilos en formato JSON.
+ *
+ * El resultado tiene la forma {"calculos":N,"operaciones":{"+":{"llamadas":N,"errores":N},...},"latencias":[...]},
+ * donde solo aparecen los operadores usados y la posición i de "latencias" cuenta los cálculos que tardaron entre
+ * 2^i y 2^(i+1) - 1 nanosegundos.
+ *
+ * @param medicion Conjunto de mediciones.
+ * @param buffer Buffer donde se escribe el texto, terminado en '\0'.
+ * @param size Tamaño del buffer.
+ * @return Cantidad de caracteres escritos sin contar el '\0', o -1 si el buffer no alcanza.
+ */
+int MedicionSerializar(medicion_t medicion, char buffer[], size_t size);
+
+/**
+ * @brief Incrementa un contador de un hilo.
+ *
+ * Solo el hilo dueño escribe el contador, por lo que alcanza con una lectura y una escritura atómicas sin orden.
+ *
+ * @param contador Contador a incrementar.
+ */
+static inline void MedicionContar(_Atomic uint64_t * contador) {
+    atomic_store_explicit(contador, atomic_load_explicit(contador, memory_order_relaxed) + 1, memory_order_relaxed);
+}
+
+/**
+ * @brief Lee el reloj monotónico.
+ *
+ * @return Tiempo actual en nanosegundos desde un origen arbitrario.
+ */
+static inline uint64_t MedicionTiempo(void) {
+    struct timespec ahora;
+
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    return (uint64_t)ahora.tv_sec * 1000000000u + (uint64_t)ahora.tv_nsec;
+}
+
+/**
+ * @brief Registra la duración de un cálculo en el histograma de latencias del hilo.
+ *
+ * @param hilo Contadores del hilo.
+ * @param nanosegundos Duración del cálculo.
+ */
+static inline void MedicionLatencia(medicion_hilo_t hilo, uint64_t nanosegundos) {
+    unsigned cubeta = 63 - (unsigned)__builtin_clzll(nanosegundos | 1);
+
+    MedicionContar(&hilo->latencias[(cubeta < MEDICION_CUBETAS) ? cubeta : (MEDICION_CUBETAS - 1)]);
+}
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEDICION_H_ */
@@ -0,0 +1,143 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef PADRON_H_
+#define PADRON_H_
+
+/** @file padron.h
+ ** @brief declaración del módulo de padrones de alumnos guardados por columnas
+ **
+ ** Un padrón copia los datos de muchos alumnos en columnas separadas: los documentos en un arreglo contiguo de enteros
+ ** y las referencias a los nombres y apellidos internados en sus propios arreglos. Los nombres no se copian: cada fila
+ ** toma una referencia más a los textos del alumno, de modo que ocupa 12 bytes en las columnas y los textos se
+ ** conservan, aunque se destruya el alumno, hasta que se destruye el padrón. Con USAR_MEMORIA_ESTATICA esos textos
+ ** siguen ocupando la memoria de textos mientras el padrón exista. Los recorridos que solo miran el
+ ** documento leen 4 bytes por alumno en lugar del registro completo, y los filtros por rango de documento se resuelven
+ ** con instrucciones SIMD. Cada alumno se identifica por su fila, que es el orden en que se agregó al padrón.
+ **
+ ** Un padrón puede consultarse desde varios hilos a la vez, pero no debe modificarse mientras se consulta.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "alumno.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a un padrón de alumnos
+typedef struct padron_s * padron_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un padrón vacío.
+ *
+ * @return Referencia al nuevo padrón, o NULL si no se pudo asignar memoria.
+ */
+padron_t PadronCrear(void);
+
+/**
+ * @brief Destruye un padrón liberando sus columnas y sus referencias a los textos. Los alumnos copiados no se
+ *        modifican.
+ *
+ * @param padron Padrón a destruir. Si es NULL no se hace nada.
+ */
+void PadronDestruir(padron_t padron);
+
+/**
+ * @brief Copia los datos de un alumno en una nueva fila al final del padrón.
+ *
+ * @param padron Padrón a modificar.
+ * @param alumno Alumno a copiar.
+ * @return true si se agregó la fila, false si no se pudo asignar memoria o no se pudo tomar una referencia a sus
+ *         textos.
+ */
+bool PadronAgregar(padron_t padron, alumno_t alumno);
+
+/**
+ * @brief Informa la cantidad de filas del padrón.
+ *
+ * @param padron Padrón a consultar.
+ * @return Cantidad de alumnos agregados.
+ */
+size_t PadronCantidad(padron_t padron);
+
+/**
+ * @brief Consulta el documento de una fila.
+ *
+ * @param padron Padrón a consultar.
+ * @param fila Fila entre 0 y PadronCantidad() - 1.
+ * @return Documento del alumno de la fila.
+ */
+uint32_t PadronDocumento(padron_t padron, size_t fila);
+
+/**
+ * @brief Consulta el nombre de una fila.
+ *
+ * @param padron Padrón a consultar.
+ * @param fila Fila entre 0 y PadronCantidad() - 1.
+ * @return Nombre terminado en '\0', válido mientras exista el padrón.
+ */
+const char * PadronNombre(padron_t padron, size_t fila);
+
+/**
+ * @brief Consulta el apellido de una fila.
+ *
+ * @param padron Padrón a consultar.
+ * @param fila Fila entre 0 y PadronCantidad() - 1.
+ * @return Apellido terminado en '\0', válido mientras exista el padrón.
+ */
+const char * PadronApellido(padron_t padron, size_t fila);
+
+/**
+ * @brief Busca las filas cuyo documento está en el rango [minimo, maximo].
+ *
+ * Al primer uso se detectan las extensiones del procesador y se elige la implementación más rápida disponible
+ * (AVX2, SSE4.1 o escalar).
+ *
+ * @param padron Padrón a recorrer.
+ * @param minimo Menor documento incluido en el rango.
+ * @param maximo Mayor documento incluido en el rango.
+ * @param filas Arreglo donde se guardan, en orden creciente, las filas encontradas. Debe tener lugar para
+ *        PadronCantidad() filas.
+ * @return Cantidad de filas encontradas, 0 si minimo es mayor que maximo.
+ */
+size_t PadronFiltrarDocumento(padron_t padron, uint32_t minimo, uint32_t maximo, uint32_t filas[]);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PADRON_H_ */
@@ -0,0 +1,93 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PARALELO_H_
+#define PARALELO_H_
+
+/** @file paralelo.h
+ ** @brief declaración del módulo para repartir trabajo entre varios hilos
+ **
+ ** El trabajo se describe como un rango de índices que se divide en bloques. Cada hilo recibe una porción contigua
+ ** de bloques y, cuando termina la suya, roba la mitad de lo que le queda al hilo más atrasado, de modo que los
+ ** bloques de costo desparejo no dejan núcleos ociosos.
+ **
+ ** Los hilos forman un grupo permanente que se crea la primera vez que hace falta y queda esperando el trabajo
+ ** siguiente, de modo que los trabajos chicos no pagan la creación de hilos en cada llamada.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define PARALELO_HILOS_MAX 64 //!< cantidad máxima de hilos que se usan para repartir un trabajo
+
+/* === Public data type declarations =============================================================================== */
+
+//! Función que procesa los índices del rango [inicio, fin) de un trabajo
+typedef void (*paralelo_tarea_t)(void * contexto, size_t inicio, size_t fin);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Procesa los índices [0, cantidad) repartiéndolos en bloques entre varios hilos con robo de trabajo.
+ *
+ * El hilo que llama participa del trabajo y la función no retorna hasta que todos los bloques fueron procesados.
+ * Si el trabajo tiene un solo bloque o no se pueden crear hilos, se procesa completo en el hilo que llama. El grupo
+ * permanente atiende una llamada a la vez: si otra llamada lo está usando, incluso desde una tarea, el trabajo se
+ * reparte entre hilos creados solo para esa llamada.
+ *
+ * @param cantidad Cantidad de índices a procesar.
+ * @param bloque Cantidad de índices que se procesan juntos en cada llamada a la tarea.
+ * @param tarea Función que procesa cada bloque.
+ * @param contexto Puntero que se pasa sin cambios a la tarea.
+ */
+void ParaleloEjecutar(size_t cantidad, size_t bloque, paralelo_tarea_t tarea, void * contexto);
+
+/**
+ * @brief Limita la cantidad de hilos que usa ParaleloEjecutar.
+ *
+ * @param hilos Cantidad máxima de hilos, o 0 para usar todos los procesadores disponibles.
+ */
+void ParaleloLimitarHilos(size_t hilos);
+
+/**
+ * @brief Informa la cantidad de hilos que usará ParaleloEjecutar en un trabajo suficientemente grande.
+ *
+ * @return Cantidad de hilos, entre 1 y PARALELO_HILOS_MAX.
+ */
+size_t ParaleloHilos(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PARALELO_H_ */
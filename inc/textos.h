@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef TEXTOS_H_
+#define TEXTOS_H_
+
+/** @file textos.h
+ ** @brief declaración del módulo de textos compartidos e internados
+ **
+ ** Los textos se guardan una sola vez en bloques de memoria y se identifican por un número de 32 bits. Internar un
+ ** texto que ya existe devuelve el mismo número, de modo que los nombres y apellidos que se repiten ocupan memoria
+ ** una sola vez. Cada llamada a TextosInternar entrega una referencia que se devuelve con TextosLiberar; cuando se
+ ** libera la última, el espacio del texto vuelve a estar disponible. Los textos no se mueven, por lo que los punteros
+ ** que entrega TextosCadena son válidos mientras quede alguna referencia.
+ **
+ ** El espacio de cada texto es una potencia de dos de al menos 32 bytes, que incluye una cabecera de 8 bytes y el
+ ** '\0' final; los espacios libres contiguos se vuelven a unir. Con memoria dinámica los bloques se piden con malloc
+ ** a medida que hacen falta. Con USAR_MEMORIA_ESTATICA se toman de una memoria fija de TEXTOS_MEMORIA bytes, que
+ ** config.h dimensiona según ALUMNO_MAX, y TextosInternar devuelve TEXTO_INVALIDO cuando se agota.
+ **
+ ** Todas las funciones pueden usarse desde varios hilos a la vez.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define TEXTO_VACIO 0 //!< número del texto vacío, que no ocupa memoria
+
+#define TEXTO_INVALIDO UINT32_MAX //!< número que se devuelve cuando no se pudo internar un texto
+
+#define TEXTOS_LARGO_MAX UINT16_MAX //!< cantidad máxima de caracteres de un texto, sin contar el '\0'
+
+/* === Public data type declarations =============================================================================== */
+
+//! Número que identifica un texto internado
+typedef uint32_t texto_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Interna un texto, guardándolo si es la primera vez que aparece.
+ *
+ * @param texto Caracteres del texto, no necesitan terminar en '\0'.
+ * @param largo Cantidad de caracteres del texto.
+ * @return Número del texto con una referencia nueva que debe liberarse con TextosLiberar, o TEXTO_INVALIDO si el
+ *         texto es demasiado largo, contiene un '\0' o no hay memoria.
+ */
+texto_t TextosInternar(const char texto[], size_t largo);
+
+/**
+ * @brief Devuelve una referencia a un texto, liberando su espacio si era la última.
+ *
+ * @param texto Número del texto. TEXTO_VACIO y TEXTO_INVALIDO se ignoran.
+ */
+void TextosLiberar(texto_t texto);
+
+/**
+ * @brief Consulta los caracteres de un texto internado.
+ *
+ * @param texto Número del texto.
+ * @return Texto terminado en '\0', válido mientras quede alguna referencia al texto.
+ */
+const char * TextosCadena(texto_t texto);
+
+/**
+ * @brief Consulta la cantidad de caracteres de un texto internado.
+ *
+ * @param texto Número del texto.
+ * @return Cantidad de caracteres, sin contar el '\0'.
+ */
+size_t TextosLargo(texto_t texto);
+
+/**
+ * @brief Informa cuánta memoria ocupan los textos internados.
+ *
+ * @param cantidad Variable donde se guarda la cantidad de textos distintos, puede ser NULL.
+ * @return Bytes que ocupan los espacios de los textos guardados, sin contar la tabla de búsqueda.
+ */
+size_t TextosMemoria(size_t * cantidad);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEXTOS_H_ */
@@ -0,0 +1,120 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef VECTOR_H_
+#define VECTOR_H_
+
+/** @file vector.h
+ ** @brief declaración del módulo de operaciones aritméticas elemento a elemento sobre arreglos de enteros
+ **
+ ** Cada función aplica la operación a los elementos de igual índice de dos arreglos. Al primer uso se detectan las
+ ** extensiones del procesador y se elige la implementación más rápida disponible (AVX2, SSE4.1 o escalar).
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Función que aplica una operación elemento a elemento: salida[i] = a[i] op b[i]
+typedef void (*vector_operacion_t)(const int a[], const int b[], int salida[], size_t n);
+
+//! Función que reduce un arreglo a un único valor combinando todos sus elementos
+typedef int (*vector_reduccion_t)(const int a[], size_t n);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Suma elemento a elemento: salida[i] = a[i] + b[i], con aritmética módulo 2^32.
+ *
+ * @param a Primer arreglo de sumandos.
+ * @param b Segundo arreglo de sumandos.
+ * @param salida Arreglo donde se guardan los resultados, puede coincidir con a o con b.
+ * @param n Cantidad de elementos.
+ */
+void VectorSumar(const int a[], const int b[], int salida[], size_t n);
+
+/**
+ * @brief Resta elemento a elemento: salida[i] = a[i] - b[i], con aritmética módulo 2^32.
+ *
+ * @param a Arreglo de minuendos.
+ * @param b Arreglo de sustraendos.
+ * @param salida Arreglo donde se guardan los resultados, puede coincidir con a o con b.
+ * @param n Cantidad de elementos.
+ */
+void VectorRestar(const int a[], const int b[], int salida[], size_t n);
+
+/**
+ * @brief Multiplica elemento a elemento: salida[i] = a[i] * b[i], con aritmética módulo 2^32.
+ *
+ * @param a Primer arreglo de factores.
+ * @param b Segundo arreglo de factores.
+ * @param salida Arreglo donde se guardan los resultados, puede coincidir con a o con b.
+ * @param n Cantidad de elementos.
+ */
+void VectorMultiplicar(const int a[], const int b[], int salida[], size_t n);
+
+/**
+ * @brief Divide elemento a elemento: salida[i] = a[i] / b[i], truncando hacia cero.
+ *
+ * Las divisiones por cero dan 0, igual que OperacionDiv, y INT_MIN / -1 da INT_MIN.
+ *
+ * @param a Arreglo de dividendos.
+ * @param b Arreglo de divisores.
+ * @param salida Arreglo donde se guardan los resultados, puede coincidir con a o con b.
+ * @param n Cantidad de elementos.
+ */
+void VectorDividir(const int a[], const int b[], int salida[], size_t n);
+
+/**
+ * @brief Suma todos los elementos de un arreglo, con aritmética módulo 2^32.
+ *
+ * @param a Arreglo a sumar.
+ * @param n Cantidad de elementos.
+ * @return Suma de los elementos, o 0 si el arreglo está vacío.
+ */
+int VectorSumarTodos(const int a[], size_t n);
+
+/**
+ * @brief Multiplica todos los elementos de un arreglo, con aritmética módulo 2^32.
+ *
+ * @param a Arreglo a multiplicar.
+ * @param n Cantidad de elementos.
+ * @return Producto de los elementos, o 1 si el arreglo está vacío.
+ */
+int VectorMultiplicarTodos(const int a[], size_t n);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTOR_H_ */
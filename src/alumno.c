@@ -24,54 +24,443 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "alumno.h"
-#include <stdio.h>
+#include "conversion.h"
+#include "escritor.h"
+#include "paralelo.h"
+#include "textos.h"
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdlib.h>
+#include <sys/uio.h>
 #include <stdbool.h>
 #include <string.h>
+#include <unistd.h>
 #include "config.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* === Macros definitions ========================================================================================== */
 
+//! Fragmento JSON ya codificado con el nombre de un campo y la comilla que abre su valor
+#define CLAVE_LITERAL(campo) "\"" campo "\":\""
+
+//! Fragmento JSON ya codificado con el nombre de un campo y la comilla que abre su valor, seguido de su longitud
+#define CLAVE(campo) CLAVE_LITERAL(campo), sizeof(CLAVE_LITERAL(campo)) - 1
+
+//! Caracteres de un alumno serializado que no dependen de sus datos
+#define SERIALIZADO_FIJO (sizeof("{\"nombre\":\"\",\"apellido\":\"\",\"documento\":\"\"}") - 1)
+
+#define LOTE_BLOQUE 128 //!< alumnos que serializa juntos cada hilo en un mismo buffer
+
+#define LOTE_BLOQUES 32 //!< bloques que forman una tanda, escrita con una sola llamada a writev
+
+#define NINGUNO UINT32_MAX //!< índice que marca el final de la lista de instancias libres
+
+#define PILA(etiqueta, indice) (((uint64_t)(etiqueta) << 32) | (uint32_t)(indice)) //!< empaqueta la cima de la pila
+
+#define PILA_ETIQUETA(pila) ((uint32_t)((pila) >> 32)) //!< cantidad de cambios de la pila, para evitar el problema ABA
+
+#define PILA_INDICE(pila) ((uint32_t)(pila)) //!< primera instancia libre de una pila empaquetada
+
+#ifdef USAR_MEMORIA_ESTATICA
+#define INSTANCIAS_MAX ALUMNO_MAX //!< cantidad máxima de instancias
+#else
+#define BLOQUES_MAX 65536 //!< cantidad máxima de bloques de ALUMNO_BLOQUE instancias que se pueden reservar
+
+#define INSTANCIAS_MAX ((uint32_t)BLOQUES_MAX * ALUMNO_BLOQUE) //!< cantidad máxima de instancias
+
+#define CACHE_MAX 64 //!< instancias libres que guarda cada hilo antes de devolverlas a la pila compartida
+
+#define CACHE_LOTE 16 //!< instancias nuevas que reserva juntas un hilo cuando su cache y la pila estan vacias
+#endif
+
+#define INDICE_MINIMO 16 //!< cantidad de lugares con la que empieza el índice por documento
+
+#define LOTE_BUFFER_INICIAL (LOTE_BLOQUE * 64) //!< bytes iniciales del buffer de un bloque, que crece si hace falta
+
+#define LECTURA_TAMANO (1 << 20) //!< bytes que se leen del archivo en cada llamada a read al cargar un lote
+
+//! Indica si un carácter es uno de los espacios que JSON permite entre los elementos de un arreglo
+#define ES_ESPACIO(caracter)                                                                                           \
+    (((caracter) == ' ') || ((caracter) == '\n') || ((caracter) == '\r') || ((caracter) == '\t'))
+
+#define INCOMPLETO 0 //!< resultado de un análisis que necesita más caracteres de los disponibles
+
+#define INVALIDO -1 //!< resultado de un análisis que encontró caracteres que no corresponden al formato
+
+//! Ejecuta un paso del análisis de un alumno y avanza, o termina el análisis si el paso no se pudo completar
+#define LEER(paso)                                                                                                     \
+    do {                                                                                                               \
+        int leidos = (paso);                                                                                           \
+        if (leidos <= 0) {                                                                                             \
+            return leidos;                                                                                             \
+        }                                                                                                              \
+        usado += (size_t)leidos;                                                                                       \
+    } while (0)
+
 /* === Private data type declarations ============================================================================== */
 
 struct alumno_s {
-    char nombre[20];    //!< Nombre del alumno
-    char apellido[20];  //!< apellido del alumno
+    texto_t nombre;                  //!< Nombre del alumno, una referencia al texto internado
+    texto_t apellido;                //!< apellido del alumno, una referencia al texto internado
+    uint32_t documento;              //!< documento del alumno
+    _Atomic uint32_t siguiente;      //!< índice de la siguiente instancia libre, mientras la instancia no esta ocupada
+    uint32_t indice;                 //!< posición de la instancia en el conjunto de instancias
+    atomic_bool ocupado;             //!< indica si la instancia esta ocupada
+    atomic_bool indexado;            //!< indica si la instancia esta en el índice por documento
+};
+
+/**
+ * @brief Lugar del índice por documento, con la clave copiada para no acceder a la instancia al comparar.
+ */
+
+struct entrada_s {
     uint32_t documento; //!< documento del alumno
-#ifdef USAR_MEMORIA_ESTATICA
-    
-    bool ocupado;     //!< indica si la instancia esta ocupada
+    uint32_t lugar;     //!< posición de la instancia más uno, o 0 si el lugar esta vacío
+};
 
+#ifndef USAR_MEMORIA_ESTATICA
+/**
+ * @brief Instancias libres que guarda cada hilo para crear y destruir alumnos sin competir con los demás hilos.
+ */
+
+struct cache_s {
+    uint32_t cantidad;            //!< cantidad de instancias guardadas
+    uint32_t indices[CACHE_MAX];  //!< posiciones de las instancias guardadas
+    bool registrada;              //!< indica si se registró la devolución de la cache al terminar el hilo
+};
 #endif
+
+/**
+ * @brief Datos de un alumno leídos de un texto JSON, antes de crear su instancia.
+ */
+
+struct datos_s {
+    char nombre[ALUMNO_LARGO_MAX + 1];   //!< nombre del alumno
+    char apellido[ALUMNO_LARGO_MAX + 1]; //!< apellido del alumno
+    uint32_t documento;                  //!< documento del alumno
+};
+
+/**
+ * @brief Archivo que se lee de a tramos grandes, conservando los caracteres que quedan sin analizar.
+ */
+
+struct lectura_s {
+    int descriptor; //!< descriptor del que se lee
+    char * buffer;  //!< caracteres leídos, de LECTURA_TAMANO bytes
+    size_t inicio;  //!< primer carácter sin analizar
+    size_t fin;     //!< carácter siguiente al último leído
+    bool terminada; //!< indica que se llegó al final del archivo
+};
+
+//! Etapas del análisis de un arreglo JSON de alumnos
+typedef enum {
+    ETAPA_APERTURA,  //!< se espera el '[' que abre el arreglo
+    ETAPA_PRIMERO,   //!< se espera el primer alumno o el ']' de un arreglo vacío
+    ETAPA_ELEMENTO,  //!< se espera un alumno después de una ','
+    ETAPA_SEPARADOR, //!< se espera una ',' o el ']' que cierra el arreglo
+    ETAPA_TERMINADA, //!< el arreglo se cerró y solo pueden quedar espacios
+} etapa_t;
+
+/**
+ * @brief Tanda de alumnos de un lote, serializada por bloques en paralelo y escrita con una sola llamada a writev.
+ *
+ * Cada bloque tiene su propio buffer, de modo que los hilos no comparten memoria mientras serializan y los bloques
+ * se escriben en orden sin copiarlos a un buffer común. La tanda anterior se escribe en el mismo reparto de trabajo
+ * en que se serializa la tanda, como un bloque más.
+ */
+
+struct tanda_s {
+    alumno_t * alumnos;                    //!< alumnos del lote completo
+    size_t primero;                        //!< índice en el lote del primer alumno de la tanda
+    size_t cantidad;                       //!< cantidad de alumnos de la tanda
+    struct tanda_s * anterior;             //!< tanda ya serializada que se escribe mientras tanto, o NULL
+    escritor_t escritores[LOTE_BLOQUES];   //!< buffer de cada bloque, que se conserva de una tanda a la siguiente
+    atomic_bool fallo;                     //!< indica que algún alumno no se pudo serializar
+    struct iovec partes[LOTE_BLOQUES + 1]; //!< bloques a escribir, más el cierre del arreglo en la última tanda
+    int cantidad_partes;                   //!< cantidad de partes a escribir
+    int descriptor;                        //!< descriptor donde se escribe la tanda
+    bool escrita;                          //!< resultado de la escritura
 };
 
 /* === Private function declarations =============================================================================== */
 
+/*
+* @brief Entrega una instancia libre, tomandola de la lista de liberadas o de las que nunca se usaron
+*
+*@return alumno_t devuelve la instancia o NULL si no quedan instancias ni se pudo reservar otro bloque
+*/
+
 static alumno_t CrearInstancia(void);
 
 /*
-* @brief
+* @brief Busca una instancia a partir de su posición en el conjunto de instancias
+*
+*@param indice posición de la instancia
+*@return alumno_t devuelve la instancia
+*/
+
+static alumno_t Instancia(uint32_t indice);
+
+/*
+* @brief Toma la primera instancia de la pila compartida de instancias libres
+*
+*@return alumno_t devuelve la instancia o NULL si la pila esta vacia
+*/
+
+static alumno_t TomarLibre(void);
+
+/*
+* @brief Agrega una instancia a la pila compartida de instancias libres
+*
+*@param self instancia a agregar
+*/
+
+static void DevolverLibre(alumno_t self);
+
+/*
+* @brief Reserva posiciones de instancias que nunca se usaron
+*
+*@param deseadas cantidad de posiciones que se quieren reservar
+*@param primera variable donde se guarda la primera posición reservada
+*@return uint32_t devuelve la cantidad de posiciones reservadas, entre 0 y deseadas
+*/
+
+static uint32_t ReservarNuevas(uint32_t deseadas, uint32_t * primera);
+
+/*
+* @brief Calcula el lugar donde empieza la búsqueda de un documento en el índice
+*
+*@param documento documento a buscar
+*@param tamano cantidad de lugares del índice
+*@return uint32_t devuelve el lugar, entre 0 y tamano - 1
+*/
+
+static uint32_t Posicion(uint32_t documento, uint32_t tamano);
+
+/*
+* @brief Busca el lugar del índice que ocupa un documento, con el cerrojo del índice tomado
+*
+*@param documento documento a buscar
+*@return uint32_t devuelve el lugar o NINGUNO si el documento no esta indexado
+*/
+
+static uint32_t BuscarLugar(uint32_t documento);
+
+/*
+* @brief Quita un alumno del índice, con el cerrojo de escritura del índice tomado
+*
+*@param self alumno a quitar
+*/
+
+static void QuitarDelIndice(alumno_t self);
+
+#ifndef USAR_MEMORIA_ESTATICA
+/*
+* @brief Duplica la cantidad de lugares del índice y vuelve a ubicar los documentos indexados
+*
+*@return bool devuelve true si se agrando el índice, false si no hay memoria
+*/
+
+static bool AgrandarIndice(void);
+#endif
+
+#ifndef USAR_MEMORIA_ESTATICA
+/*
+* @brief Se asegura de que exista el bloque que contiene una posición, reservandolo si hace falta
+*
+*@param indice posición de la instancia
+*@return bool devuelve true si el bloque existe, false si no se pudo reservar
+*/
+
+static bool AsegurarBloque(uint32_t indice);
+
+/*
+* @brief Guarda una instancia libre en la cache del hilo, devolviendo la mitad a la pila compartida si esta llena
+*
+*@param indice posición de la instancia
+*/
+
+static void GuardarEnCache(uint32_t indice);
+
+/*
+* @brief Devuelve a la pila compartida las instancias de la cache de un hilo que termina
+*
+*@param argumento cache del hilo
+*/
+
+static void VaciarCache(void * argumento);
+
+/*
+* @brief Crea la clave que permite vaciar la cache de cada hilo al terminar
+*/
+
+static void CrearClaveCache(void);
+#endif
+
+/*
+* @brief Cuenta los caracteres que agregan los escapes de JSON a un texto
+*
+*@param valor caracteres del texto
+*@param largo cantidad de caracteres del texto
+*@return size_t caracteres que hay que agregar al texto para escaparlo
+*/
+
+static size_t Escapados(const char valor[], size_t largo);
+
+/*
+* @brief Cuenta las cifras decimales de un entero sin signo
+*
+*@param valor entero a medir
+*@return size_t cantidad de cifras
+*/
+
+static size_t Cifras(uint32_t valor);
+
+/*
+* @brief Calcula el largo exacto de un alumno serializado
 *
-*@param campo estruct de apellido, nombre y documento
+*@param self alumno a medir
+*@param escapados_nombre variable donde se guardan los caracteres que agregan los escapes del nombre
+*@param escapados_apellido variable donde se guardan los caracteres que agregan los escapes del apellido
+*@return size_t cantidad de caracteres sin contar el '\0'
+*/
+
+static size_t Medir(alumno_t self, size_t * escapados_nombre, size_t * escapados_apellido);
+
+/*
+* @brief Serializa un campo de texto como "campo":"valor", escapando el valor según JSON
+*
+*@param buffer donde se escribe el campo, con lugar suficiente
+*@param clave fragmento ya codificado con el nombre del campo, generado con CLAVE
+*@param largo_clave cantidad de caracteres de la clave
 *@param valor el valor del parametro a analizar en este caso nombre o apellido
-*@param buffer donde escribira el puntero
-*@param disponibles espacio disponible en la cadena
-*@return int devuelve un -1 si el espacio asignado es menor de los que se escribio en la cadena, sino devuelve la suma de todos los caracteres que ocupan espacio en la cadena
+*@param largo_valor cantidad de caracteres del valor
+*@param escapados caracteres que agregan los escapes del valor, calculados con Escapados
+*@return char* devuelve la posición siguiente a la coma que separa el campo siguiente
+*/
+
+static char * SerializarCadena(char buffer[], const char clave[], size_t largo_clave, const char valor[],
+                               size_t largo_valor, size_t escapados);
+
+/*
+* @brief Serializa un alumno en un buffer donde ya se sabe que entra, agregando el '\0'
+*
+*@param self alumno a serializar
+*@param buffer donde se escribe el alumno, con lugar para el largo calculado con Medir más el '\0'
+*@param escapados_nombre caracteres que agregan los escapes del nombre, calculados con Medir
+*@param escapados_apellido caracteres que agregan los escapes del apellido, calculados con Medir
+*/
+
+static void Serializar(alumno_t self, char buffer[], size_t escapados_nombre, size_t escapados_apellido);
+
+/*
+* @brief Compara el comienzo de un texto con un fragmento fijo del formato
+*
+*@param texto caracteres disponibles
+*@param disponibles cantidad de caracteres disponibles
+*@param literal fragmento esperado
+*@param largo cantidad de caracteres del fragmento
+*@return int devuelve el largo si coincide, INCOMPLETO si coincide lo disponible pero es más corto que el fragmento, o
+* INVALIDO si no coincide
+*/
+
+static int Literal(const char texto[], size_t disponibles, const char literal[], size_t largo);
+
+/*
+* @brief Busca la primera comilla, barra invertida o carácter de control de un texto, de a 16 caracteres con SSE2
+*
+*@param texto caracteres disponibles
+*@param disponibles cantidad de caracteres disponibles
+*@return size_t devuelve la posición del carácter encontrado o disponibles si no hay ninguno
+*/
+
+static size_t BuscarEspecial(const char texto[], size_t disponibles);
+
+/*
+* @brief Lee el valor de un campo de texto hasta su comilla de cierre, interpretando los escapes de JSON
+*
+*@param texto caracteres disponibles, a partir del primero del valor
+*@param disponibles cantidad de caracteres disponibles
+*@param destino donde se guarda el valor terminado en '\0', con lugar para ALUMNO_LARGO_MAX + 1 caracteres
+*@return int devuelve los caracteres leidos incluida la comilla de cierre, INCOMPLETO o INVALIDO
+*/
+
+static int LeerTexto(const char texto[], size_t disponibles, char destino[]);
+
+/*
+* @brief Lee el valor del documento hasta su comilla de cierre
+*
+*@param texto caracteres disponibles, a partir del primero del valor
+*@param disponibles cantidad de caracteres disponibles
+*@param documento donde se guarda el valor
+*@return int devuelve los caracteres leidos incluida la comilla de cierre, INCOMPLETO o INVALIDO
 */
 
-static int SerializarCadena(char campo[], const char valor[], char buffer[], uint32_t disponibles);
+static int LeerDocumento(const char texto[], size_t disponibles, uint32_t * documento);
 
 /*
-* @brief
+* @brief Lee un alumno con el formato exacto que genera AlumnoSerializar
 *
-*@param campo estruct de apellido, nombre y documento
-*@param valor el valor del parametro a analizar en este caso documento
-*@param buffer donde escribira el puntero
-*@param disponibles espacio disponible en la cadena
-*@return int devuelve un -1 si el espacio asignado es menor de los que se escribio en la cadena, sino devuelve la suma de todos los caracteres que ocupan espacio en la cadena
+*@param texto caracteres disponibles, a partir de la '{'
+*@param disponibles cantidad de caracteres disponibles
+*@param datos donde se guardan los datos leidos
+*@return int devuelve los caracteres leidos incluida la '}', INCOMPLETO o INVALIDO
 */
 
-static int SerializarDocumento(char campo[], uint32_t valor, char buffer[], uint32_t disponibles);
+static int LeerAlumno(const char texto[], size_t disponibles, struct datos_s * datos);
+
+/*
+* @brief Descarta los caracteres ya analizados de una lectura y lee del archivo todos los que entran en el buffer
+*
+*@param lectura lectura a completar
+*@return bool devuelve false si hubo un error al leer
+*/
+
+static bool Rellenar(struct lectura_s * lectura);
+
+/*
+* @brief Serializa los alumnos de una tanda en el buffer de cada bloque, precedidos por '[' o ','
+*
+*@param contexto tanda que se esta serializando
+*@param inicio primer alumno de la tanda a serializar
+*@param fin alumno siguiente al ultimo a serializar
+*/
+
+static void SerializarBloques(void * contexto, size_t inicio, size_t fin);
+
+/*
+* @brief Escribe todas las partes en el descriptor, reintentando las escrituras parciales o interrumpidas
+*
+*@param descriptor archivo o tuberia donde se escribe
+*@param partes partes a escribir, se modifican a medida que avanza la escritura
+*@param cantidad cantidad de partes
+*@return bool devuelve true si se escribieron todas las partes, false si hubo un error
+*/
+
+static bool EscribirPartes(int descriptor, struct iovec partes[], int cantidad);
+
+/*
+* @brief Escribe una tanda ya serializada y guarda el resultado de la escritura en la tanda
+*
+*@param tanda tanda a escribir
+*/
+
+static void EscribirTanda(struct tanda_s * tanda);
+
+/*
+* @brief Procesa un bloque del reparto de una tanda: el primero escribe la tanda anterior y los demas serializan
+*
+*@param contexto tanda que se esta serializando
+*@param inicio primer indice del reparto, desplazado en LOTE_BLOQUE respecto de los alumnos de la tanda
+*@param fin indice siguiente al ultimo a procesar
+*/
+
+static void ProcesarTanda(void * contexto, size_t inicio, size_t fin);
 
 /* === Private variable definitions ================================================================================ */
 
@@ -79,78 +468,859 @@ static int SerializarDocumento(char campo[], uint32_t valor, char buffer[], uint
 
 static struct alumno_s instancias [ALUMNO_MAX] = {0}; //!< Instancia de la estructura alumno_s
 
+#else
+
+static struct alumno_s * _Atomic bloques[BLOQUES_MAX] = {0}; //!< bloques de ALUMNO_BLOQUE instancias reservados
+
+static _Thread_local struct cache_s cache = {0}; //!< instancias libres guardadas por cada hilo
+
+static pthread_key_t clave_cache; //!< clave para vaciar la cache de cada hilo al terminar
+
+static pthread_once_t clave_cache_creada = PTHREAD_ONCE_INIT; //!< asegura que la clave se crea una sola vez
+
 #endif
+
+static _Atomic uint64_t libre = PILA(0, NINGUNO); //!< pila de instancias liberadas, con su etiqueta de cambios
+
+static _Atomic uint32_t usados = 0; //!< instancias entregadas alguna vez, las siguientes nunca se usaron
+
+#ifdef USAR_MEMORIA_ESTATICA
+
+static struct entrada_s entradas[2 * ALUMNO_MAX] = {0}; //!< lugares del índice por documento
+
+static const uint32_t tamano_indice = 2 * ALUMNO_MAX; //!< cantidad de lugares del índice
+
+#else
+
+static struct entrada_s * entradas = NULL; //!< lugares del índice por documento
+
+static uint32_t tamano_indice = 0; //!< cantidad de lugares del índice
+
+#endif
+
+static uint32_t indexados = 0; //!< cantidad de alumnos en el índice
+
+static pthread_rwlock_t cerrojo_indice = PTHREAD_RWLOCK_INITIALIZER; //!< protege el índice por documento
+
+//! Letra que sigue a la barra invertida al escapar cada carácter ASCII en JSON, 'u' para "\u00XX" o 0 si no se escapa
+static const char escapes[128] = {
+    [0x00] = 'u', [0x01] = 'u', [0x02] = 'u', [0x03] = 'u', [0x04] = 'u', [0x05] = 'u', [0x06] = 'u', [0x07] = 'u',
+    [0x08] = 'b', [0x09] = 't', [0x0A] = 'n', [0x0B] = 'u', [0x0C] = 'f', [0x0D] = 'r', [0x0E] = 'u', [0x0F] = 'u',
+    [0x10] = 'u', [0x11] = 'u', [0x12] = 'u', [0x13] = 'u', [0x14] = 'u', [0x15] = 'u', [0x16] = 'u', [0x17] = 'u',
+    [0x18] = 'u', [0x19] = 'u', [0x1A] = 'u', [0x1B] = 'u', [0x1C] = 'u', [0x1D] = 'u', [0x1E] = 'u', [0x1F] = 'u',
+    ['"'] = '"',  ['\\'] = '\\',
+};
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
-#ifdef USAR_MEMORIA_ESTATICA
 alumno_t CrearInstancia(void) {
     alumno_t self = NULL;
+    uint32_t primera;
 
-    for (int i = 0; i < ALUMNO_MAX; i++) {
-        if (!instancias[i].ocupado) {
-            instancias[i].ocupado = true;
-            self = &instancias[i];
-            break;
+#ifndef USAR_MEMORIA_ESTATICA
+    if (cache.cantidad > 0) {
+        self = Instancia(cache.indices[--cache.cantidad]);
+    }
+#endif
+    if (self == NULL) {
+        self = TomarLibre();
+    }
+#ifdef USAR_MEMORIA_ESTATICA
+    if ((self == NULL) && ReservarNuevas(1, &primera)) {
+        self = Instancia(primera);
+        self->indice = primera;
+    }
+#else
+    if (self == NULL) {
+        uint32_t reservadas = ReservarNuevas(CACHE_LOTE, &primera);
+        if ((reservadas == 0) || !AsegurarBloque(primera)) {
+            return NULL;
         }
+        for (uint32_t i = 0; i < reservadas; i++) {
+            Instancia(primera + i)->indice = primera + i;
+        }
+        // Las reservadas que sobran quedan en la cache para que las próximas creaciones no toquen el contador
+        for (uint32_t i = reservadas - 1; i > 0; i--) {
+            GuardarEnCache(primera + i);
+        }
+        self = Instancia(primera);
+    }
+#endif
+    if (self != NULL) {
+        atomic_store_explicit(&self->ocupado, true, memory_order_relaxed);
     }
     return self;
+}
+
+alumno_t Instancia(uint32_t indice) {
+#ifdef USAR_MEMORIA_ESTATICA
+    return &instancias[indice];
+#else
+    struct alumno_s * bloque = atomic_load_explicit(&bloques[indice / ALUMNO_BLOQUE], memory_order_acquire);
+    return &bloque[indice % ALUMNO_BLOQUE];
+#endif
+}
+
+alumno_t TomarLibre(void) {
+    uint64_t pila = atomic_load_explicit(&libre, memory_order_acquire);
+
+    while (PILA_INDICE(pila) != NINGUNO) {
+        alumno_t self = Instancia(PILA_INDICE(pila));
+        uint32_t siguiente = atomic_load_explicit(&self->siguiente, memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(&libre, &pila, PILA(PILA_ETIQUETA(pila) + 1, siguiente),
+                                                  memory_order_acquire, memory_order_acquire)) {
+            return self;
+        }
+    }
+    return NULL;
+}
+
+void DevolverLibre(alumno_t self) {
+    uint64_t pila = atomic_load_explicit(&libre, memory_order_relaxed);
 
+    do {
+        atomic_store_explicit(&self->siguiente, PILA_INDICE(pila), memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&libre, &pila, PILA(PILA_ETIQUETA(pila) + 1, self->indice),
+                                                    memory_order_release, memory_order_relaxed));
+}
+
+uint32_t ReservarNuevas(uint32_t deseadas, uint32_t * primera) {
+    uint32_t actual = atomic_load_explicit(&usados, memory_order_relaxed);
+    uint32_t reservadas;
+
+    do {
+        if (actual >= INSTANCIAS_MAX) {
+            return 0;
+        }
+        reservadas = (INSTANCIAS_MAX - actual < deseadas) ? INSTANCIAS_MAX - actual : deseadas;
+#ifndef USAR_MEMORIA_ESTATICA
+        // Las posiciones reservadas juntas quedan siempre en un mismo bloque
+        if (ALUMNO_BLOQUE - actual % ALUMNO_BLOQUE < reservadas) {
+            reservadas = ALUMNO_BLOQUE - actual % ALUMNO_BLOQUE;
+        }
+#endif
+    } while (!atomic_compare_exchange_weak_explicit(&usados, &actual, actual + reservadas, memory_order_relaxed,
+                                                    memory_order_relaxed));
+    *primera = actual;
+    return reservadas;
+}
+
+uint32_t Posicion(uint32_t documento, uint32_t tamano) {
+    uint32_t mezcla = documento * 0x9E3779B1u; // Los documentos consecutivos quedan repartidos en todo el índice
+
+    return (uint32_t)(((uint64_t)mezcla * tamano) >> 32);
+}
+
+uint32_t BuscarLugar(uint32_t documento) {
+    if (tamano_indice == 0) {
+        return NINGUNO;
+    }
+    for (uint32_t lugar = Posicion(documento, tamano_indice); entradas[lugar].lugar != 0;) {
+        if (entradas[lugar].documento == documento) {
+            return lugar;
+        }
+        if (++lugar == tamano_indice) {
+            lugar = 0;
+        }
+    }
+    return NINGUNO;
+}
+
+void QuitarDelIndice(alumno_t self) {
+    uint32_t vacio = BuscarLugar(self->documento);
+
+    if ((vacio == NINGUNO) || (entradas[vacio].lugar != self->indice + 1)) {
+        return;
+    }
+    // Se corren hacia atrás los documentos que no quedarían alcanzables desde su posición a través del hueco
+    for (uint32_t lugar = vacio;;) {
+        if (++lugar == tamano_indice) {
+            lugar = 0;
+        }
+        if (entradas[lugar].lugar == 0) {
+            break;
+        }
+        uint32_t inicio = Posicion(entradas[lugar].documento, tamano_indice);
+        bool movible = (vacio <= lugar) ? ((inicio <= vacio) || (inicio > lugar))
+                                        : ((inicio <= vacio) && (inicio > lugar));
+        if (movible) {
+            entradas[vacio] = entradas[lugar];
+            vacio = lugar;
+        }
+    }
+    entradas[vacio].lugar = 0;
+    indexados--;
+    atomic_store_explicit(&self->indexado, false, memory_order_relaxed);
+}
+
+#ifndef USAR_MEMORIA_ESTATICA
+bool AgrandarIndice(void) {
+    uint32_t tamano = (tamano_indice == 0) ? INDICE_MINIMO : 2 * tamano_indice;
+    struct entrada_s * nuevas = calloc(tamano, sizeof(struct entrada_s));
+
+    if (nuevas == NULL) {
+        return false;
+    }
+    for (uint32_t i = 0; i < tamano_indice; i++) {
+        if (entradas[i].lugar != 0) {
+            uint32_t lugar = Posicion(entradas[i].documento, tamano);
+            while (nuevas[lugar].lugar != 0) {
+                if (++lugar == tamano) {
+                    lugar = 0;
+                }
+            }
+            nuevas[lugar] = entradas[i];
+        }
+    }
+    free(entradas);
+    entradas = nuevas;
+    tamano_indice = tamano;
+    return true;
 }
 #endif
 
-int SerializarCadena(char campo[], const char valor[], char buffer[], uint32_t disponibles) {
-    return snprintf(buffer, disponibles, "\"%s\":\"%s\",", campo, valor);
+#ifndef USAR_MEMORIA_ESTATICA
+bool AsegurarBloque(uint32_t indice) {
+    struct alumno_s * _Atomic * lugar = &bloques[indice / ALUMNO_BLOQUE];
+    struct alumno_s * esperado = NULL;
+
+    if (atomic_load_explicit(lugar, memory_order_acquire) != NULL) {
+        return true;
+    }
+    struct alumno_s * bloque = malloc(ALUMNO_BLOQUE * sizeof(struct alumno_s));
+    if (bloque == NULL) {
+        return false;
+    }
+    for (uint32_t i = 0; i < ALUMNO_BLOQUE; i++) {
+        atomic_init(&bloque[i].siguiente, NINGUNO);
+        atomic_init(&bloque[i].ocupado, false);
+        atomic_init(&bloque[i].indexado, false);
+    }
+    // Si otro hilo instaló el bloque primero se usa el suyo
+    if (!atomic_compare_exchange_strong_explicit(lugar, &esperado, bloque, memory_order_acq_rel,
+                                                 memory_order_acquire)) {
+        free(bloque);
+    }
+    return true;
+}
+
+void GuardarEnCache(uint32_t indice) {
+    if (!cache.registrada) {
+        pthread_once(&clave_cache_creada, CrearClaveCache);
+        cache.registrada = (pthread_setspecific(clave_cache, &cache) == 0);
+    }
+    if (cache.cantidad == CACHE_MAX) {
+        while (cache.cantidad > CACHE_MAX / 2) {
+            DevolverLibre(Instancia(cache.indices[--cache.cantidad]));
+        }
+    }
+    cache.indices[cache.cantidad++] = indice;
+}
+
+void VaciarCache(void * argumento) {
+    struct cache_s * propia = argumento;
+
+    while (propia->cantidad > 0) {
+        DevolverLibre(Instancia(propia->indices[--propia->cantidad]));
+    }
+}
+
+void CrearClaveCache(void) {
+    pthread_key_create(&clave_cache, VaciarCache);
+}
+#endif
+
+size_t Escapados(const char valor[], size_t largo) {
+    size_t escapados = 0;
+
+    for (size_t i = 0; i < largo; i++) {
+        unsigned char caracter = (unsigned char)valor[i];
+        if ((caracter < sizeof(escapes)) && escapes[caracter]) {
+            escapados += (escapes[caracter] == 'u') ? 5 : 1;
+        }
+    }
+    return escapados;
+}
+
+size_t Cifras(uint32_t valor) {
+    size_t cifras = 1;
+
+    while (valor >= 10) {
+        valor = valor / 10;
+        cifras++;
+    }
+    return cifras;
+}
+
+size_t Medir(alumno_t self, size_t * escapados_nombre, size_t * escapados_apellido) {
+    size_t largo_nombre = TextosLargo(self->nombre);
+    size_t largo_apellido = TextosLargo(self->apellido);
+
+    *escapados_nombre = Escapados(TextosCadena(self->nombre), largo_nombre);
+    *escapados_apellido = Escapados(TextosCadena(self->apellido), largo_apellido);
+    return SERIALIZADO_FIJO + largo_nombre + *escapados_nombre + largo_apellido + *escapados_apellido +
+           Cifras(self->documento);
+}
+
+char * SerializarCadena(char buffer[], const char clave[], size_t largo_clave, const char valor[], size_t largo_valor,
+                        size_t escapados) {
+    memcpy(buffer, clave, largo_clave);
+    buffer += largo_clave;
+    if (escapados == 0) {
+        memcpy(buffer, valor, largo_valor);
+        buffer += largo_valor;
+    } else {
+        for (size_t i = 0; i < largo_valor; i++) {
+            unsigned char caracter = (unsigned char)valor[i];
+            char escape = (caracter < sizeof(escapes)) ? escapes[caracter] : 0;
+            if (!escape) {
+                *buffer++ = (char)caracter;
+            } else if (escape != 'u') {
+                *buffer++ = '\\';
+                *buffer++ = escape;
+            } else {
+                memcpy(buffer, "\\u00", 4);
+                buffer[4] = "0123456789abcdef"[caracter >> 4];
+                buffer[5] = "0123456789abcdef"[caracter & 0x0F];
+                buffer += 6;
+            }
+        }
+    }
+    memcpy(buffer, "\",", 2); // Cierra el valor y separa el campo siguiente
+    return buffer + 2;
+}
+
+void Serializar(alumno_t self, char buffer[], size_t escapados_nombre, size_t escapados_apellido) {
+    *buffer++ = '{';
+    buffer = SerializarCadena(buffer, CLAVE("nombre"), TextosCadena(self->nombre), TextosLargo(self->nombre),
+                              escapados_nombre);
+    buffer = SerializarCadena(buffer, CLAVE("apellido"), TextosCadena(self->apellido), TextosLargo(self->apellido),
+                              escapados_apellido);
+    memcpy(buffer, CLAVE("documento"));
+    buffer += sizeof(CLAVE_LITERAL("documento")) - 1;
+    buffer += ConversionSinSignoATexto(self->documento, buffer);
+    memcpy(buffer, "\"}", 3); // Cierra el valor y el objeto y agrega el '\0'
+}
+
+int Literal(const char texto[], size_t disponibles, const char literal[], size_t largo) {
+    if (disponibles < largo) {
+        return (memcmp(texto, literal, disponibles) == 0) ? INCOMPLETO : INVALIDO;
+    }
+    return (memcmp(texto, literal, largo) == 0) ? (int)largo : INVALIDO;
+}
+
+size_t BuscarEspecial(const char texto[], size_t disponibles) {
+    size_t i = 0;
+
+#ifdef __SSE2__
+    const __m128i comilla = _mm_set1_epi8('"');
+    const __m128i barra = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1F);
+
+    for (; i + 16 <= disponibles; i += 16) {
+        __m128i bloque = _mm_loadu_si128((const __m128i *)(texto + i));
+        // Un carácter es de control cuando el máximo sin signo entre él y 0x1F sigue siendo 0x1F
+        __m128i especiales = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bloque, comilla), _mm_cmpeq_epi8(bloque, barra)),
+                                          _mm_cmpeq_epi8(_mm_max_epu8(bloque, control), control));
+        int mascara = _mm_movemask_epi8(especiales);
+        if (mascara) {
+            return i + (size_t)__builtin_ctz((unsigned)mascara);
+        }
+    }
+#endif
+    for (; i < disponibles; i++) {
+        unsigned char caracter = (unsigned char)texto[i];
+        if ((caracter == '"') || (caracter == '\\') || (caracter < 0x20)) {
+            break;
+        }
+    }
+    return i;
+}
+
+int LeerTexto(const char texto[], size_t disponibles, char destino[]) {
+    size_t leidos = 0;
+    size_t escritos = 0;
+
+    while (true) {
+        size_t tramo = BuscarEspecial(texto + leidos, disponibles - leidos);
+        if (escritos + tramo > ALUMNO_LARGO_MAX) {
+            return INVALIDO;
+        }
+        memcpy(destino + escritos, texto + leidos, tramo);
+        escritos += tramo;
+        leidos += tramo;
+        if (leidos == disponibles) {
+            return INCOMPLETO;
+        }
+        if (texto[leidos] == '"') {
+            destino[escritos] = '\0';
+            return (int)leidos + 1;
+        }
+        if (texto[leidos] != '\\') {
+            return INVALIDO;
+        }
+        if (leidos + 2 > disponibles) {
+            return INCOMPLETO;
+        }
+
+        char escape = texto[leidos + 1];
+        const char * letras = "\"\\/bfnrt";
+        const char * valores = "\"\\/\b\f\n\r\t";
+        const char * letra = (escape != '\0') ? strchr(letras, escape) : NULL;
+        if (letra) {
+            if (escritos + 1 > ALUMNO_LARGO_MAX) {
+                return INVALIDO;
+            }
+            destino[escritos++] = valores[letra - letras];
+            leidos += 2;
+            continue;
+        }
+        if (escape != 'u') {
+            return INVALIDO;
+        }
+        if (leidos + 6 > disponibles) {
+            return INCOMPLETO;
+        }
+
+        uint32_t codigo = 0;
+        for (size_t i = leidos + 2; i < leidos + 6; i++) {
+            const char * hexadecimales = "0123456789abcdef0123456789ABCDEF";
+            const char * cifra = (texto[i] != '\0') ? strchr(hexadecimales, texto[i]) : NULL;
+            if (cifra == NULL) {
+                return INVALIDO;
+            }
+            codigo = (codigo << 4) | (uint32_t)((cifra - hexadecimales) & 0x0F);
+        }
+        // Los caracteres fuera de ASCII se guardan en UTF-8; el '\0' y las mitades de pares sustitutos no se aceptan
+        size_t bytes = (codigo < 0x80) ? 1 : (codigo < 0x800) ? 2 : 3;
+        if ((codigo == 0) || ((codigo >= 0xD800) && (codigo <= 0xDFFF)) || (escritos + bytes > ALUMNO_LARGO_MAX)) {
+            return INVALIDO;
+        }
+        if (bytes == 1) {
+            destino[escritos++] = (char)codigo;
+        } else if (bytes == 2) {
+            destino[escritos++] = (char)(0xC0 | (codigo >> 6));
+            destino[escritos++] = (char)(0x80 | (codigo & 0x3F));
+        } else {
+            destino[escritos++] = (char)(0xE0 | (codigo >> 12));
+            destino[escritos++] = (char)(0x80 | ((codigo >> 6) & 0x3F));
+            destino[escritos++] = (char)(0x80 | (codigo & 0x3F));
+        }
+        leidos += 6;
+    }
+}
+
+int LeerDocumento(const char texto[], size_t disponibles, uint32_t * documento) {
+    uint64_t valor = 0;
+    size_t leidos = 0;
+
+    for (; (leidos < disponibles) && (texto[leidos] >= '0') && (texto[leidos] <= '9'); leidos++) {
+        valor = valor * 10 + (uint64_t)(texto[leidos] - '0');
+        if ((leidos >= 10) || (valor > UINT32_MAX)) {
+            return INVALIDO;
+        }
+    }
+    if (leidos == disponibles) {
+        return INCOMPLETO;
+    }
+    if ((leidos == 0) || (texto[leidos] != '"')) {
+        return INVALIDO;
+    }
+    *documento = (uint32_t)valor;
+    return (int)leidos + 1;
+}
+
+int LeerAlumno(const char texto[], size_t disponibles, struct datos_s * datos) {
+    size_t usado = 0;
+
+    LEER(Literal(texto + usado, disponibles - usado, "{", 1));
+    LEER(Literal(texto + usado, disponibles - usado, CLAVE("nombre")));
+    LEER(LeerTexto(texto + usado, disponibles - usado, datos->nombre));
+    LEER(Literal(texto + usado, disponibles - usado, ",", 1));
+    LEER(Literal(texto + usado, disponibles - usado, CLAVE("apellido")));
+    LEER(LeerTexto(texto + usado, disponibles - usado, datos->apellido));
+    LEER(Literal(texto + usado, disponibles - usado, ",", 1));
+    LEER(Literal(texto + usado, disponibles - usado, CLAVE("documento")));
+    LEER(LeerDocumento(texto + usado, disponibles - usado, &datos->documento));
+    LEER(Literal(texto + usado, disponibles - usado, "}", 1));
+    return (int)usado;
+}
+
+bool Rellenar(struct lectura_s * lectura) {
+    memmove(lectura->buffer, lectura->buffer + lectura->inicio, lectura->fin - lectura->inicio);
+    lectura->fin -= lectura->inicio;
+    lectura->inicio = 0;
+
+    while (true) {
+        ssize_t leidos = read(lectura->descriptor, lectura->buffer + lectura->fin, LECTURA_TAMANO - lectura->fin);
+        if (leidos > 0) {
+            lectura->fin += (size_t)leidos;
+            return true;
+        }
+        if (leidos == 0) {
+            lectura->terminada = true;
+            return true;
+        }
+        if (errno != EINTR) {
+            return false;
+        }
+    }
 }
 
-int SerializarDocumento(char campo[], uint32_t valor, char buffer[], uint32_t disponibles) {
-    return snprintf(buffer, disponibles, "\"%s\":\"%u\"}", campo, valor);
+void SerializarBloques(void * contexto, size_t inicio, size_t fin) {
+    struct tanda_s * tanda = contexto;
+
+    while (inicio < fin) {
+        size_t bloque = inicio / LOTE_BLOQUE;
+        size_t limite = (bloque + 1) * LOTE_BLOQUE;
+        escritor_t * escritor = &tanda->escritores[bloque];
+
+        if (limite > fin) {
+            limite = fin;
+        }
+        if (*escritor == NULL) {
+            *escritor = EscritorCrear(LOTE_BUFFER_INICIAL);
+        }
+        if (*escritor == NULL) {
+            atomic_store_explicit(&tanda->fallo, true, memory_order_relaxed);
+            return;
+        }
+        EscritorVaciar(*escritor);
+        for (; inicio < limite; inicio++) {
+            alumno_t alumno = tanda->alumnos[tanda->primero + inicio];
+            char separador = (tanda->primero + inicio == 0) ? '[' : ',';
+
+            if ((alumno == NULL) || !EscritorAgregar(*escritor, &separador, 1) ||
+                (AlumnoSerializarEn(alumno, *escritor) < 0)) {
+                atomic_store_explicit(&tanda->fallo, true, memory_order_relaxed);
+                return;
+            }
+        }
+    }
+}
+
+bool EscribirPartes(int descriptor, struct iovec partes[], int cantidad) {
+    while (cantidad > 0) {
+        ssize_t escritos = writev(descriptor, partes, cantidad);
+        if (escritos < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if ((escritos == 0) && (partes->iov_len > 0)) {
+            return false;
+        }
+        while ((cantidad > 0) && ((size_t)escritos >= partes->iov_len)) {
+            escritos -= partes->iov_len;
+            partes++;
+            cantidad--;
+        }
+        if (cantidad > 0) {
+            partes->iov_base = (char *)partes->iov_base + escritos;
+            partes->iov_len -= escritos;
+        }
+    }
+    return true;
+}
+
+void EscribirTanda(struct tanda_s * tanda) {
+    tanda->escrita = EscribirPartes(tanda->descriptor, tanda->partes, tanda->cantidad_partes);
+}
+
+void ProcesarTanda(void * contexto, size_t inicio, size_t fin) {
+    struct tanda_s * tanda = contexto;
+
+    if (inicio < LOTE_BLOQUE) {
+        if (tanda->anterior) {
+            EscribirTanda(tanda->anterior);
+        }
+        inicio = LOTE_BLOQUE;
+    }
+    if (inicio < fin) {
+        SerializarBloques(tanda, inicio - LOTE_BLOQUE, fin - LOTE_BLOQUE);
+    }
 }
+
 /* === Public function definitions ============================================================================== */
 
 alumno_t AlumnoCrear(char * nombre, char * apellido, uint32_t dni) {
+    size_t largo_nombre = strnlen(nombre, ALUMNO_LARGO_MAX + 1);
+    size_t largo_apellido = strnlen(apellido, ALUMNO_LARGO_MAX + 1);
 
-#ifdef USAR_MEMORIA_ESTATICA 
-    alumno_t self = CrearInstancia();
-#else 
-    alumno_t self = malloc(sizeof(struct alumno_s));
-#endif
+    if ((largo_nombre > ALUMNO_LARGO_MAX) || (largo_apellido > ALUMNO_LARGO_MAX)) {
+        return NULL;
+    }
+
+    texto_t texto_nombre = TextosInternar(nombre, largo_nombre);
+    texto_t texto_apellido = TextosInternar(apellido, largo_apellido);
+    alumno_t self = NULL;
+    if ((texto_nombre != TEXTO_INVALIDO) && (texto_apellido != TEXTO_INVALIDO)) {
+        self = CrearInstancia();
+    }
     if (self != NULL) {
         self ->documento = dni;
-        strncpy(self ->nombre, nombre, sizeof(self ->nombre) - 1);
-        strncpy(self ->apellido, apellido, sizeof(self ->apellido) - 1);
+        self ->nombre = texto_nombre;
+        self ->apellido = texto_apellido;
+    } else {
+        TextosLiberar(texto_nombre);
+        TextosLiberar(texto_apellido);
     }
 
     return self;
 }
 
+void AlumnoDestruir(alumno_t self) {
+    if ((self != NULL) && atomic_load_explicit(&self->indexado, memory_order_relaxed)) {
+        AlumnoDesindexar(self);
+    }
+    if ((self != NULL) && atomic_exchange_explicit(&self->ocupado, false, memory_order_relaxed)) {
+        TextosLiberar(self->nombre);
+        TextosLiberar(self->apellido);
+#ifdef USAR_MEMORIA_ESTATICA
+        DevolverLibre(self);
+#else
+        GuardarEnCache(self->indice);
+#endif
+    }
+}
+
+bool AlumnoIndexar(alumno_t self) {
+    bool resultado = false;
+
+    if (self == NULL) {
+        return false;
+    }
+    pthread_rwlock_wrlock(&cerrojo_indice);
+#ifndef USAR_MEMORIA_ESTATICA
+    // El índice se mantiene a lo sumo medio lleno para que las búsquedas recorran pocos lugares
+    if ((2 * (uint64_t)(indexados + 1) > tamano_indice) && !AgrandarIndice()) {
+        pthread_rwlock_unlock(&cerrojo_indice);
+        return false;
+    }
+#endif
+    if (BuscarLugar(self->documento) == NINGUNO) {
+        uint32_t lugar = Posicion(self->documento, tamano_indice);
+        while (entradas[lugar].lugar != 0) {
+            if (++lugar == tamano_indice) {
+                lugar = 0;
+            }
+        }
+        entradas[lugar].documento = self->documento;
+        entradas[lugar].lugar = self->indice + 1;
+        indexados++;
+        atomic_store_explicit(&self->indexado, true, memory_order_relaxed);
+        resultado = true;
+    }
+    pthread_rwlock_unlock(&cerrojo_indice);
+    return resultado;
+}
+
+void AlumnoDesindexar(alumno_t self) {
+    if (self != NULL) {
+        pthread_rwlock_wrlock(&cerrojo_indice);
+        QuitarDelIndice(self);
+        pthread_rwlock_unlock(&cerrojo_indice);
+    }
+}
+
+alumno_t AlumnoBuscarPorDocumento(uint32_t documento) {
+    alumno_t self = NULL;
+
+    pthread_rwlock_rdlock(&cerrojo_indice);
+    uint32_t lugar = BuscarLugar(documento);
+    if (lugar != NINGUNO) {
+        self = Instancia(entradas[lugar].lugar - 1);
+    }
+    pthread_rwlock_unlock(&cerrojo_indice);
+    return self;
+}
+
+uint32_t AlumnoDocumento(alumno_t self) {
+    return self->documento;
+}
+
+const char * AlumnoNombre(alumno_t self) {
+    return TextosCadena(self->nombre);
+}
+
+const char * AlumnoApellido(alumno_t self) {
+    return TextosCadena(self->apellido);
+}
+
 int AlumnoSerializar(alumno_t self, char buffer[], uint32_t size) {
-    int escritos;
-    int resultado;
-
-    buffer[0] = '{';
-    buffer++;
-    escritos = 1;
-    resultado = SerializarCadena("nombre", self->nombre, buffer, size - escritos);
-    if (resultado < 0 || resultado >= size - escritos) {
+    size_t escapados_nombre;
+    size_t escapados_apellido;
+    size_t largo = Medir(self, &escapados_nombre, &escapados_apellido);
+
+    if (largo >= size) {
         return -1;
     }
+    Serializar(self, buffer, escapados_nombre, escapados_apellido);
+    return (int)largo;
+}
+
+size_t AlumnoTamanoSerializado(alumno_t self) {
+    size_t escapados_nombre;
+    size_t escapados_apellido;
 
-    buffer = buffer + resultado;
-    escritos = escritos + resultado;
-    resultado = SerializarCadena("apellido", self->apellido, buffer, size - escritos);
-    if (resultado < 0 || resultado >= size - escritos) {
+    return Medir(self, &escapados_nombre, &escapados_apellido);
+}
+
+int AlumnoSerializarEn(alumno_t self, escritor_t escritor) {
+    size_t escapados_nombre;
+    size_t escapados_apellido;
+    size_t largo = Medir(self, &escapados_nombre, &escapados_apellido);
+    char * destino = EscritorReservar(escritor, largo);
+
+    if (destino == NULL) {
         return -1;
     }
+    Serializar(self, destino, escapados_nombre, escapados_apellido);
+    EscritorAvanzar(escritor, largo);
+    return (int)largo;
+}
+
+int AlumnoSerializarLote(alumno_t alumnos[], size_t cantidad, int descriptor) {
+    static char cierre[] = "]";
+    struct tanda_s tandas[2];
+    struct tanda_s * anterior = NULL;
+    bool correcto = true;
 
-    buffer = buffer + resultado;
-    escritos = escritos + resultado;
-    resultado = SerializarDocumento("documento", self->documento, buffer, size-escritos);
-    if (resultado < 0 || resultado >= size - escritos) {
+    if (cantidad == 0) {
+        struct iovec vacio = {.iov_base = "[]", .iov_len = 2};
+        return EscribirPartes(descriptor, &vacio, 1) ? 0 : -1;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        tandas[i].alumnos = alumnos;
+        tandas[i].descriptor = descriptor;
+        memset(tandas[i].escritores, 0, sizeof(tandas[i].escritores));
+    }
+
+    // Cada reparto serializa una tanda en un juego de buffers y, con uno de sus hilos, escribe la anterior desde el
+    // otro, de modo que los hilos permanentes de ParaleloEjecutar hacen también la escritura
+    for (size_t primero = 0, numero = 0; correcto && (primero < cantidad); numero++) {
+        struct tanda_s * tanda = &tandas[numero % 2];
+
+        tanda->primero = primero;
+        tanda->cantidad = cantidad - primero;
+        if (tanda->cantidad > LOTE_BLOQUES * LOTE_BLOQUE) {
+            tanda->cantidad = LOTE_BLOQUES * LOTE_BLOQUE;
+        }
+        tanda->anterior = anterior;
+        atomic_init(&tanda->fallo, false);
+        ParaleloEjecutar(LOTE_BLOQUE + tanda->cantidad, LOTE_BLOQUE, ProcesarTanda, tanda);
+        primero = primero + tanda->cantidad;
+
+        if ((anterior && !anterior->escrita) || atomic_load_explicit(&tanda->fallo, memory_order_relaxed)) {
+            correcto = false;
+            break;
+        }
+
+        size_t bloques = (tanda->cantidad + LOTE_BLOQUE - 1) / LOTE_BLOQUE;
+        for (size_t i = 0; i < bloques; i++) {
+            tanda->partes[i].iov_base = (void *)EscritorDatos(tanda->escritores[i]);
+            tanda->partes[i].iov_len = EscritorLargo(tanda->escritores[i]);
+        }
+        if (primero == cantidad) {
+            tanda->partes[bloques].iov_base = cierre;
+            tanda->partes[bloques].iov_len = 1;
+            bloques++;
+        }
+        tanda->cantidad_partes = (int)bloques;
+        anterior = tanda;
+    }
+    if (correcto && anterior) {
+        EscribirTanda(anterior);
+        correcto = anterior->escrita;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        for (size_t j = 0; j < LOTE_BLOQUES; j++) {
+            EscritorDestruir(tandas[i].escritores[j]);
+        }
+    }
+    return correcto ? 0 : -1;
+}
+
+alumno_t AlumnoDeserializar(const char buffer[], uint32_t size) {
+    struct datos_s datos;
+    int leidos = LeerAlumno(buffer, size, &datos);
+
+    if ((leidos <= 0) || (((uint32_t)leidos < size) && (buffer[leidos] != '\0'))) {
+        return NULL;
+    }
+    return AlumnoCrear(datos.nombre, datos.apellido, datos.documento);
+}
+
+int AlumnoDeserializarLote(int descriptor, alumno_t alumnos[], size_t capacidad) {
+    struct lectura_s lectura = {.descriptor = descriptor};
+    etapa_t etapa = ETAPA_APERTURA;
+    size_t cantidad = 0;
+    bool correcto = true;
+
+    if (capacidad > INT_MAX) {
+        capacidad = INT_MAX;
+    }
+    lectura.buffer = malloc(LECTURA_TAMANO);
+    if (lectura.buffer == NULL) {
+        return -1;
+    }
+
+    while (correcto) {
+        char * buffer = lectura.buffer;
+        while ((lectura.inicio < lectura.fin) && ES_ESPACIO(buffer[lectura.inicio])) {
+            lectura.inicio++;
+        }
+        if (lectura.inicio == lectura.fin) {
+            if (lectura.terminada) {
+                break;
+            }
+            correcto = Rellenar(&lectura);
+            continue;
+        }
+
+        char caracter = buffer[lectura.inicio];
+        if ((etapa == ETAPA_APERTURA) && (caracter == '[')) {
+            etapa = ETAPA_PRIMERO;
+            lectura.inicio++;
+        } else if (((etapa == ETAPA_PRIMERO) || (etapa == ETAPA_SEPARADOR)) && (caracter == ']')) {
+            etapa = ETAPA_TERMINADA;
+            lectura.inicio++;
+        } else if ((etapa == ETAPA_SEPARADOR) && (caracter == ',')) {
+            etapa = ETAPA_ELEMENTO;
+            lectura.inicio++;
+        } else if ((etapa == ETAPA_PRIMERO) || (etapa == ETAPA_ELEMENTO)) {
+            struct datos_s datos;
+            int leidos = LeerAlumno(buffer + lectura.inicio, lectura.fin - lectura.inicio, &datos);
+            if (leidos == INCOMPLETO) {
+                // Un alumno completo siempre entra en el buffer, salvo que el archivo termine a la mitad
+                correcto = !lectura.terminada && (lectura.inicio > 0 || lectura.fin < LECTURA_TAMANO) &&
+                           Rellenar(&lectura);
+            } else if ((leidos == INVALIDO) || (cantidad == capacidad)) {
+                correcto = false;
+            } else {
+                alumnos[cantidad] = AlumnoCrear(datos.nombre, datos.apellido, datos.documento);
+                correcto = (alumnos[cantidad] != NULL);
+                cantidad += correcto;
+                lectura.inicio += (size_t)leidos;
+                etapa = ETAPA_SEPARADOR;
+            }
+        } else {
+            correcto = false;
+        }
+    }
+    free(lectura.buffer);
+
+    if (!correcto || (etapa != ETAPA_TERMINADA)) {
+        while (cantidad > 0) {
+            AlumnoDestruir(alumnos[--cantidad]);
+        }
         return -1;
     }
-    escritos = escritos + resultado;
-    return escritos;
+    return (int)cantidad;
 }
 
 /* === End of documentation ======================================================================================== */
@@ -0,0 +1,120 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file arena.c
+ ** @brief codigo fuente del módulo de asignación de memoria por avance sobre un bloque provisto por el usuario
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "arena.h"
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define ALINEACION alignof(max_align_t) //!< alineación de todos los bloques asignados
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Datos de control de una arena, ubicados al comienzo del bloque que reparte.
+ */
+
+struct arena_s {
+    unsigned char * inicio; //!< primer byte que se puede asignar
+    size_t tamano;          //!< cantidad de bytes que se pueden asignar
+    _Atomic size_t usado;   //!< cantidad de bytes asignados desde el inicio
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Redondea una cantidad hacia arriba al múltiplo de la alineación.
+ *
+ * @param valor Cantidad a redondear.
+ * @return Cantidad redondeada, o 0 si no entra en un size_t.
+ */
+
+static size_t Alinear(size_t valor);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static size_t Alinear(size_t valor) {
+    if (valor > SIZE_MAX - (ALINEACION - 1)) {
+        return 0;
+    }
+    return (valor + ALINEACION - 1) & ~(size_t)(ALINEACION - 1);
+}
+
+/* === Public function implementation ============================================================================== */
+
+arena_t ArenaCrear(void * memoria, size_t tamano) {
+    if (!memoria) {
+        return NULL;
+    }
+
+    size_t relleno = Alinear((uintptr_t)memoria) - (uintptr_t)memoria;
+    size_t control = relleno + Alinear(sizeof(struct arena_s));
+    if (tamano < control) {
+        return NULL;
+    }
+
+    arena_t arena = (arena_t)((unsigned char *)memoria + relleno);
+    arena->inicio = (unsigned char *)memoria + control;
+    arena->tamano = tamano - control;
+    atomic_init(&arena->usado, 0);
+    return arena;
+}
+
+void * ArenaAsignar(arena_t arena, size_t tamano) {
+    size_t necesario = Alinear(tamano ? tamano : 1);
+    size_t usado = atomic_load_explicit(&arena->usado, memory_order_relaxed);
+
+    do {
+        if ((necesario == 0) || (necesario > arena->tamano - usado)) {
+            return NULL;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&arena->usado, &usado, usado + necesario, memory_order_relaxed,
+                                                    memory_order_relaxed));
+
+    return arena->inicio + usado;
+}
+
+void ArenaDevolver(arena_t arena, void * bloque, size_t tamano) {
+    if (!bloque) {
+        return;
+    }
+
+    size_t desde = (size_t)((unsigned char *)bloque - arena->inicio);
+    size_t hasta = desde + Alinear(tamano ? tamano : 1);
+    atomic_compare_exchange_strong_explicit(&arena->usado, &hasta, desde, memory_order_relaxed, memory_order_relaxed);
+}
+
+void ArenaReiniciar(arena_t arena) {
+    atomic_store_explicit(&arena->usado, 0, memory_order_relaxed);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,191 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file conversion.c
+ ** @brief programa que compara las conversiones entre enteros y texto con atoi y snprintf
+ **
+ ** Antes de medir se comprueba que ConversionTextoAEntero y ConversionEnteroATexto den los mismos resultados que las
+ ** funciones de la biblioteca estándar para todos los valores de la medición.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "conversion.h"
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define VALORES 4096 //!< valores distintos que se convierten en cada medición
+
+#define REPETICIONES 500 //!< veces que se convierte el conjunto completo de valores
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve el tiempo de un reloj monotónico en nanosegundos.
+ */
+static double Ahora(void);
+
+/**
+ * @brief Prepara los valores de la medición, con cantidades de dígitos repartidas entre 1 y 10, y sus textos.
+ */
+static void Preparar(void);
+
+/**
+ * @brief Comprueba que las conversiones propias coincidan con atoi y snprintf para todos los valores.
+ *
+ * @return true si todas las conversiones coinciden.
+ */
+static bool Comprobar(void);
+
+/**
+ * @brief Imprime una fila de la tabla de resultados.
+ *
+ * @param nombre Nombre de la conversión medida.
+ * @param inicio Tiempo en que comenzó la medición, devuelto por Ahora.
+ */
+static void Informar(const char * nombre, double inicio);
+
+/* === Private variable definitions ================================================================================ */
+
+static int valores[VALORES]; //!< enteros de la medición
+
+static char textos[VALORES][CONVERSION_ENTERO_MAX + 1]; //!< valores escritos en decimal y terminados en '\0'
+
+static size_t largos[VALORES]; //!< cantidad de caracteres de cada texto
+
+static char destino[CONVERSION_ENTERO_MAX + 1]; //!< buffer donde se escriben los valores durante la medición
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+double Ahora(void) {
+    struct timespec tiempo;
+
+    clock_gettime(CLOCK_MONOTONIC, &tiempo);
+    return (double)tiempo.tv_sec * 1e9 + (double)tiempo.tv_nsec;
+}
+
+void Preparar(void) {
+    srand(1);
+    for (int i = 0; i < VALORES; i++) {
+        // Se elige primero la cantidad de dígitos para que los números cortos tengan el mismo peso que los largos
+        long long limite = 1;
+        for (int digitos = 1 + rand() % 10; digitos > 0; digitos--) {
+            limite *= 10;
+        }
+        long long valor = (((long long)rand() << 31) | rand()) % limite;
+        if (valor > INT_MAX) {
+            valor = INT_MAX;
+        }
+        valores[i] = (i % 2) ? -(int)valor : (int)valor;
+        largos[i] = (size_t)snprintf(textos[i], sizeof(textos[i]), "%d", valores[i]);
+    }
+    valores[0] = INT_MIN;
+    largos[0] = (size_t)snprintf(textos[0], sizeof(textos[0]), "%d", valores[0]);
+}
+
+bool Comprobar(void) {
+    for (int i = 0; i < VALORES; i++) {
+        int leido;
+        const char * fin = ConversionTextoAEntero(textos[i], textos[i] + largos[i], &leido);
+        if ((fin != textos[i] + largos[i]) || (leido != atoi(textos[i]))) {
+            return false;
+        }
+        if ((ConversionEnteroATexto(valores[i], destino) != largos[i]) ||
+            (memcmp(destino, textos[i], largos[i]) != 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Informar(const char * nombre, double inicio) {
+    double tiempo = Ahora() - inicio;
+
+    printf("%-22s  %8.1f\n", nombre, tiempo / ((double)VALORES * REPETICIONES));
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Mide la conversión de texto a entero y de entero a texto contra atoi y snprintf.
+ *
+ * @return 0 si las conversiones coinciden con las de la biblioteca estándar, 1 en otro caso.
+ */
+
+int main(void) {
+    volatile int resultado = 0;
+    double inicio;
+
+    Preparar();
+    if (!Comprobar()) {
+        printf("las conversiones no coinciden con atoi y snprintf\n");
+        return 1;
+    }
+
+    printf("conversion              ns/valor\n");
+
+    inicio = Ahora();
+    for (int repeticion = 0; repeticion < REPETICIONES; repeticion++) {
+        for (int i = 0; i < VALORES; i++) {
+            int leido;
+            ConversionTextoAEntero(textos[i], textos[i] + largos[i], &leido);
+            resultado += leido;
+        }
+    }
+    Informar("ConversionTextoAEntero", inicio);
+
+    inicio = Ahora();
+    for (int repeticion = 0; repeticion < REPETICIONES; repeticion++) {
+        for (int i = 0; i < VALORES; i++) {
+            resultado += atoi(textos[i]);
+        }
+    }
+    Informar("atoi", inicio);
+
+    inicio = Ahora();
+    for (int repeticion = 0; repeticion < REPETICIONES; repeticion++) {
+        for (int i = 0; i < VALORES; i++) {
+            resultado += (int)ConversionEnteroATexto(valores[i], destino);
+        }
+    }
+    Informar("ConversionEnteroATexto", inicio);
+
+    inicio = Ahora();
+    for (int repeticion = 0; repeticion < REPETICIONES; repeticion++) {
+        for (int i = 0; i < VALORES; i++) {
+            resultado += snprintf(destino, sizeof(destino), "%d", valores[i]);
+        }
+    }
+    Informar("snprintf", inicio);
+
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,151 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file despacho.c
+ ** @brief programa que mide el costo de evaluar expresiones según la cantidad de operadores registrados
+ **
+ ** Con la tabla de despacho la búsqueda de cada operador es de tiempo constante, así que el tiempo por expresión
+ ** debe mantenerse igual con 4, 32 o 128 operadores registrados.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calculadora.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define EXPRESIONES 4096 //!< expresiones distintas que se evalúan en cada medición
+
+#define OPERANDOS 8 //!< operandos de cada expresión, separados por operadores registrados
+
+#define REPETICIONES 200 //!< veces que se evalúa el conjunto completo de expresiones
+
+#define PRIMER_OPERADOR 0x80 //!< carácter del primer operador registrado, fuera de los caracteres reservados
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Operación de prueba que devuelve el mayor de sus operandos.
+ */
+static int Maximo(int a, int b);
+
+/**
+ * @brief Operación de prueba que devuelve el menor de sus operandos.
+ */
+static int Minimo(int a, int b);
+
+/**
+ * @brief Devuelve el tiempo de un reloj monotónico en nanosegundos.
+ */
+static double Ahora(void);
+
+/**
+ * @brief Mide el tiempo por expresión con una cantidad dada de operadores registrados.
+ *
+ * @param operadores Cantidad de operadores a registrar.
+ * @return Nanosegundos por expresión, o un valor negativo si no se pudo crear la calculadora.
+ */
+static double Medir(int operadores);
+
+/* === Private variable definitions ================================================================================ */
+
+static char textos[EXPRESIONES][2 * OPERANDOS + 1]; //!< expresiones de la medición en curso
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+int Maximo(int a, int b) {
+    return (a > b) ? a : b;
+}
+
+int Minimo(int a, int b) {
+    return (a < b) ? a : b;
+}
+
+double Ahora(void) {
+    struct timespec tiempo;
+
+    clock_gettime(CLOCK_MONOTONIC, &tiempo);
+    return (double)tiempo.tv_sec * 1e9 + (double)tiempo.tv_nsec;
+}
+
+double Medir(int operadores) {
+    static const operacion_func_t funciones[] = {Maximo, Minimo, OperacionAdd, OperacionSub};
+    calculadora_t calculadora = CalculadoraCrear();
+    volatile int resultado = 0;
+
+    if (!calculadora) {
+        return -1;
+    }
+    for (int i = 0; i < operadores; i++) {
+        CalculadoraAddOperacion(calculadora, (char)(PRIMER_OPERADOR + i), funciones[i % 4]);
+    }
+
+    // Las expresiones recorren todos los operadores registrados, de modo que se consulta toda la tabla
+    for (int i = 0, operador = 0; i < EXPRESIONES; i++) {
+        for (int j = 0; j < OPERANDOS; j++) {
+            textos[i][2 * j] = (char)('1' + (i + j) % 9);
+            textos[i][2 * j + 1] = (char)(PRIMER_OPERADOR + operador);
+            operador = (operador + 1) % operadores;
+        }
+        textos[i][2 * OPERANDOS - 1] = '\0';
+    }
+
+    double inicio = Ahora();
+    for (int repeticion = 0; repeticion < REPETICIONES; repeticion++) {
+        for (int i = 0; i < EXPRESIONES; i++) {
+            resultado += CalculadoraCalculaTexto(calculadora, textos[i], 2 * OPERANDOS - 1);
+        }
+    }
+    double tiempo = Ahora() - inicio;
+
+    CalculadoraDestruir(calculadora);
+    return tiempo / ((double)EXPRESIONES * REPETICIONES);
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Mide la evaluación de expresiones con 4, 32 y 128 operadores registrados.
+ *
+ * @return 0 si se pudieron hacer todas las mediciones, 1 en otro caso.
+ */
+
+int main(void) {
+    static const int cantidades[] = {4, 32, 128};
+
+    printf("operadores  ns/expresion  ns/operador\n");
+    for (size_t i = 0; i < sizeof(cantidades) / sizeof(cantidades[0]); i++) {
+        double tiempo = Medir(cantidades[i]);
+        if (tiempo < 0) {
+            return 1;
+        }
+        printf("%10d  %12.1f  %11.1f\n", cantidades[i], tiempo, tiempo / (OPERANDOS - 1));
+    }
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
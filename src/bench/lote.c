@@ -0,0 +1,149 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file lote.c
+ ** @brief programa que mide cómo escala CalculadoraCalculaLote con la cantidad de hilos
+ **
+ ** Evalúa el mismo lote de expresiones de largo desparejo limitando el reparto a 1, 2, ... N hilos, donde N es la
+ ** cantidad de procesadores, y mide además el costo de llamadas con lotes chicos. Antes de medir comprueba que el
+ ** lote da los mismos resultados que CalculadoraCalcula.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calculadora.h"
+#include "paralelo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define EXPRESIONES 1000000 //!< expresiones del lote grande
+
+#define TEXTO_MAX 96 //!< caracteres máximos de cada expresión, incluido el '\0'
+
+#define LOTE_CHICO 512 //!< expresiones de cada lote chico
+
+#define LLAMADAS_CHICAS 2000 //!< lotes chicos que se evalúan en la medición
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve el tiempo de un reloj monotónico en segundos.
+ */
+static double Ahora(void);
+
+/**
+ * @brief Escribe una expresión al azar, que cada tanto es mucho más larga que las demás.
+ *
+ * @param texto Donde se escribe la expresión, con lugar para TEXTO_MAX caracteres.
+ */
+static void Generar(char texto[]);
+
+/* === Private variable definitions ================================================================================ */
+
+static char textos[EXPRESIONES][TEXTO_MAX]; //!< expresiones del lote
+
+static const char * expresiones[EXPRESIONES]; //!< punteros a las expresiones del lote
+
+static int resultados[EXPRESIONES]; //!< resultados del lote
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+double Ahora(void) {
+    struct timespec tiempo;
+
+    clock_gettime(CLOCK_MONOTONIC, &tiempo);
+    return (double)tiempo.tv_sec + (double)tiempo.tv_nsec * 1e-9;
+}
+
+void Generar(char texto[]) {
+    static const char operadores[] = "+-*/";
+    int terminos = (rand() % 16 == 0) ? 11 : 2 + rand() % 3;
+    int escritos = sprintf(texto, "%d", rand() % 100);
+
+    for (int i = 1; i < terminos; i++) {
+        escritos += sprintf(texto + escritos, " %c (%d)", operadores[rand() % 4], 1 + rand() % 99);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Mide el lote grande con 1 a N hilos y el costo de los lotes chicos.
+ *
+ * @return 0 si el lote dio los mismos resultados que CalculadoraCalcula, 1 en otro caso.
+ */
+
+int main(void) {
+    calculadora_t calculadora = CalculadoraCrear();
+    size_t procesadores = ParaleloHilos();
+    double base = 0;
+
+    CalculadoraAddOperacion(calculadora, '+', OperacionAdd);
+    CalculadoraAddOperacion(calculadora, '-', OperacionSub);
+    CalculadoraAddOperacion(calculadora, '*', OperacionMul);
+    CalculadoraAddOperacion(calculadora, '/', OperacionDiv);
+
+    srand(1);
+    for (size_t i = 0; i < EXPRESIONES; i++) {
+        Generar(textos[i]);
+        expresiones[i] = textos[i];
+    }
+
+    CalculadoraCalculaLote(calculadora, expresiones, resultados, EXPRESIONES);
+    for (size_t i = 0; i < EXPRESIONES; i++) {
+        if (resultados[i] != CalculadoraCalcula(calculadora, expresiones[i])) {
+            printf("el resultado del lote difiere en \"%s\"\n", expresiones[i]);
+            CalculadoraDestruir(calculadora);
+            return 1;
+        }
+    }
+
+    printf("hilos  segundos  expresiones/s  aceleracion\n");
+    for (size_t hilos = 1; hilos <= procesadores; hilos++) {
+        ParaleloLimitarHilos(hilos);
+        double inicio = Ahora();
+        CalculadoraCalculaLote(calculadora, expresiones, resultados, EXPRESIONES);
+        double tiempo = Ahora() - inicio;
+        if (hilos == 1) {
+            base = tiempo;
+        }
+        printf("%5zu  %8.3f  %13.0f  %11.2f\n", hilos, tiempo, EXPRESIONES / tiempo, base / tiempo);
+    }
+
+    ParaleloLimitarHilos(0);
+    double inicio = Ahora();
+    for (int i = 0; i < LLAMADAS_CHICAS; i++) {
+        size_t primera = (size_t)i * LOTE_CHICO % (EXPRESIONES - LOTE_CHICO);
+        CalculadoraCalculaLote(calculadora, expresiones + primera, resultados, LOTE_CHICO);
+    }
+    printf("lotes de %d expresiones: %.1f us por llamada\n", LOTE_CHICO, (Ahora() - inicio) * 1e6 / LLAMADAS_CHICAS);
+
+    CalculadoraDestruir(calculadora);
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
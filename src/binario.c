@@ -0,0 +1,365 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file binario.c
+ ** @brief codigo fuente del módulo de archivos binarios de alumnos que se leen sin copiarlos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "binario.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define FIRMA "ALUB" //!< primeros bytes de todo archivo binario de alumnos
+
+#define ORDEN_BYTES 0x0102 //!< se lee al revés si el archivo se escribió con el otro orden de bytes
+
+#define CON_INDICE 0x1 //!< opción de la cabecera que indica que el archivo tiene índice de documentos
+
+#define SALIDA_TAMANO 65536 //!< bytes que se juntan antes de cada escritura en el archivo
+
+#define ALINEAR(posicion) (((posicion) + 7) & ~(uint64_t)7) //!< redondea una posición al múltiplo de 8 siguiente
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Cabecera del archivo, con la posición de cada sección medida desde el comienzo del archivo.
+ */
+
+struct cabecera_s {
+    char firma[4];      //!< siempre FIRMA
+    uint16_t version;   //!< versión del formato
+    uint16_t orden;     //!< siempre ORDEN_BYTES en el orden de bytes de quien escribió el archivo
+    uint32_t cantidad;  //!< cantidad de registros
+    uint32_t opciones;  //!< combinación de opciones, por ahora solo CON_INDICE
+    uint64_t registros; //!< posición de los registros
+    uint64_t indice;    //!< posición del índice de documentos, o 0 si no tiene
+    uint64_t textos;    //!< posición de la sección de textos
+    uint64_t largo;     //!< cantidad de bytes de la sección de textos
+};
+
+/**
+ * @brief Entrada del índice de documentos, ordenado por documento y luego por fila.
+ */
+
+struct entrada_s {
+    uint32_t documento; //!< documento del alumno
+    uint32_t fila;      //!< fila del registro del alumno
+};
+
+/**
+ * @brief Archivo abierto para lectura.
+ */
+
+struct binario_s {
+    void * proyeccion;                      //!< comienzo del archivo proyectado en memoria
+    size_t tamano;                          //!< cantidad de bytes proyectados
+    const binario_registro_t * registros;   //!< registros del archivo
+    const struct entrada_s * indice;        //!< índice de documentos, o NULL si el archivo no tiene
+    const char * textos;                    //!< sección de textos
+    uint64_t largo;                         //!< cantidad de bytes de la sección de textos
+    size_t cantidad;                        //!< cantidad de registros
+};
+
+/**
+ * @brief Buffer que junta datos para escribirlos en el archivo en bloques grandes.
+ */
+
+struct salida_s {
+    int descriptor;              //!< descriptor donde se escribe
+    size_t usado;                //!< bytes del buffer ocupados
+    bool fallo;                  //!< indica que alguna escritura falló
+    char buffer[SALIDA_TAMANO];  //!< datos pendientes de escribir
+};
+
+_Static_assert(sizeof(binario_registro_t) == 16, "los registros deben ocupar 16 bytes");
+_Static_assert(sizeof(struct cabecera_s) % 8 == 0, "la cabecera debe mantener alineadas las secciones");
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Agrega datos a la salida, escribiendo el buffer cuando se llena.
+ *
+ * @param salida Salida donde se agregan los datos.
+ * @param datos Datos a agregar.
+ * @param largo Cantidad de bytes a agregar.
+ */
+static void Agregar(struct salida_s * salida, const void * datos, size_t largo);
+
+/**
+ * @brief Escribe en el archivo los datos pendientes de la salida, reintentando las escrituras parciales.
+ *
+ * @param salida Salida a vaciar.
+ */
+static void Vaciar(struct salida_s * salida);
+
+/**
+ * @brief Compara dos entradas del índice por documento y luego por fila, para ordenarlas con qsort.
+ */
+static int CompararEntradas(const void * a, const void * b);
+
+/**
+ * @brief Busca un texto en la sección de textos verificando que no se salga de ella.
+ *
+ * @param binario Archivo a consultar.
+ * @param posicion Posición del texto en la sección.
+ * @param largo Cantidad de caracteres del texto.
+ * @return Texto terminado en '\0', o "" si la posición o el largo no son válidos.
+ */
+static const char * Texto(binario_t binario, uint32_t posicion, uint16_t largo);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+void Agregar(struct salida_s * salida, const void * datos, size_t largo) {
+    const char * origen = datos;
+
+    while (largo > 0) {
+        size_t copiar = SALIDA_TAMANO - salida->usado;
+        if (copiar > largo) {
+            copiar = largo;
+        }
+        memcpy(salida->buffer + salida->usado, origen, copiar);
+        salida->usado += copiar;
+        origen += copiar;
+        largo -= copiar;
+        if (salida->usado == SALIDA_TAMANO) {
+            Vaciar(salida);
+        }
+    }
+}
+
+void Vaciar(struct salida_s * salida) {
+    size_t escritos = 0;
+
+    while (!salida->fallo && (escritos < salida->usado)) {
+        ssize_t resultado = write(salida->descriptor, salida->buffer + escritos, salida->usado - escritos);
+        if (resultado > 0) {
+            escritos += (size_t)resultado;
+        } else if ((resultado == 0) || (errno != EINTR)) {
+            salida->fallo = true;
+        }
+    }
+    salida->usado = 0;
+}
+
+int CompararEntradas(const void * a, const void * b) {
+    const struct entrada_s * x = a;
+    const struct entrada_s * y = b;
+
+    if (x->documento != y->documento) {
+        return (x->documento < y->documento) ? -1 : 1;
+    }
+    return (x->fila > y->fila) - (x->fila < y->fila);
+}
+
+const char * Texto(binario_t binario, uint32_t posicion, uint16_t largo) {
+    if (((uint64_t)posicion + largo >= binario->largo) || (binario->textos[posicion + largo] != '\0')) {
+        return "";
+    }
+    return binario->textos + posicion;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int BinarioEscribir(alumno_t alumnos[], size_t cantidad, bool indexar, int descriptor) {
+    struct cabecera_s cabecera = {.firma = FIRMA, .version = BINARIO_VERSION, .orden = ORDEN_BYTES};
+    struct entrada_s * indice = NULL;
+    uint64_t largo = 0;
+
+    if (cantidad > UINT32_MAX) {
+        return -1;
+    }
+    for (size_t i = 0; i < cantidad; i++) {
+        if (alumnos[i] == NULL) {
+            return -1;
+        }
+        largo += strlen(AlumnoNombre(alumnos[i])) + 1;
+        largo += strlen(AlumnoApellido(alumnos[i])) + 1;
+    }
+    if (largo > UINT32_MAX) {
+        return -1;
+    }
+
+    cabecera.cantidad = (uint32_t)cantidad;
+    cabecera.registros = sizeof(cabecera);
+    cabecera.textos = cabecera.registros + cantidad * sizeof(binario_registro_t);
+    cabecera.largo = largo;
+    if (indexar) {
+        indice = malloc((cantidad ? cantidad : 1) * sizeof(struct entrada_s));
+        if (indice == NULL) {
+            return -1;
+        }
+        for (size_t i = 0; i < cantidad; i++) {
+            indice[i] = (struct entrada_s){AlumnoDocumento(alumnos[i]), (uint32_t)i};
+        }
+        qsort(indice, cantidad, sizeof(struct entrada_s), CompararEntradas);
+        cabecera.opciones |= CON_INDICE;
+        cabecera.indice = cabecera.textos;
+        cabecera.textos = ALINEAR(cabecera.indice + cantidad * sizeof(struct entrada_s));
+    }
+
+    struct salida_s * salida = malloc(sizeof(struct salida_s));
+    if (salida == NULL) {
+        free(indice);
+        return -1;
+    }
+    salida->descriptor = descriptor;
+    salida->usado = 0;
+    salida->fallo = false;
+
+    Agregar(salida, &cabecera, sizeof(cabecera));
+    uint32_t posicion = 0;
+    for (size_t i = 0; i < cantidad; i++) {
+        binario_registro_t registro = {.documento = AlumnoDocumento(alumnos[i])};
+        registro.largo_nombre = (uint16_t)strlen(AlumnoNombre(alumnos[i]));
+        registro.largo_apellido = (uint16_t)strlen(AlumnoApellido(alumnos[i]));
+        registro.nombre = posicion;
+        registro.apellido = posicion + registro.largo_nombre + 1;
+        posicion = registro.apellido + registro.largo_apellido + 1;
+        Agregar(salida, &registro, sizeof(registro));
+    }
+    if (indexar) {
+        static const char relleno[8] = {0};
+        Agregar(salida, indice, cantidad * sizeof(struct entrada_s));
+        Agregar(salida, relleno, cabecera.textos - cabecera.indice - cantidad * sizeof(struct entrada_s));
+    }
+    for (size_t i = 0; i < cantidad; i++) {
+        Agregar(salida, AlumnoNombre(alumnos[i]), strlen(AlumnoNombre(alumnos[i])));
+        Agregar(salida, "", 1);
+        Agregar(salida, AlumnoApellido(alumnos[i]), strlen(AlumnoApellido(alumnos[i])));
+        Agregar(salida, "", 1);
+    }
+    Vaciar(salida);
+
+    int resultado = salida->fallo ? -1 : 0;
+    free(salida);
+    free(indice);
+    return resultado;
+}
+
+binario_t BinarioAbrir(int descriptor) {
+    struct stat estado;
+    struct cabecera_s cabecera;
+
+    if ((fstat(descriptor, &estado) != 0) || ((uint64_t)estado.st_size < sizeof(cabecera))) {
+        return NULL;
+    }
+
+    uint64_t tamano = (uint64_t)estado.st_size;
+    void * proyeccion = mmap(NULL, (size_t)tamano, PROT_READ, MAP_SHARED, descriptor, 0);
+    if (proyeccion == MAP_FAILED) {
+        return NULL;
+    }
+    memcpy(&cabecera, proyeccion, sizeof(cabecera));
+
+    uint64_t fin_registros = cabecera.registros + (uint64_t)cabecera.cantidad * sizeof(binario_registro_t);
+    uint64_t fin_indice = cabecera.indice + (uint64_t)cabecera.cantidad * sizeof(struct entrada_s);
+    bool valido = (memcmp(cabecera.firma, FIRMA, sizeof(cabecera.firma)) == 0) &&
+                  (cabecera.version == BINARIO_VERSION) && (cabecera.orden == ORDEN_BYTES) &&
+                  (cabecera.registros >= sizeof(cabecera)) && (cabecera.registros <= tamano) &&
+                  (cabecera.registros % 8 == 0) && (fin_registros <= tamano) && (cabecera.textos <= tamano) &&
+                  (cabecera.largo <= tamano - cabecera.textos);
+    if (valido && (cabecera.opciones & CON_INDICE)) {
+        valido = (cabecera.indice >= sizeof(cabecera)) && (cabecera.indice <= tamano) && (cabecera.indice % 8 == 0) &&
+                 (fin_indice <= tamano);
+    }
+
+    binario_t binario = valido ? malloc(sizeof(struct binario_s)) : NULL;
+    if (binario == NULL) {
+        munmap(proyeccion, (size_t)tamano);
+        return NULL;
+    }
+    binario->proyeccion = proyeccion;
+    binario->tamano = (size_t)tamano;
+    binario->registros = (const binario_registro_t *)((const char *)proyeccion + cabecera.registros);
+    binario->indice = NULL;
+    if (cabecera.opciones & CON_INDICE) {
+        binario->indice = (const struct entrada_s *)((const char *)proyeccion + cabecera.indice);
+    }
+    binario->textos = (const char *)proyeccion + cabecera.textos;
+    binario->largo = cabecera.largo;
+    binario->cantidad = cabecera.cantidad;
+    return binario;
+}
+
+void BinarioCerrar(binario_t binario) {
+    if (binario) {
+        munmap(binario->proyeccion, binario->tamano);
+        free(binario);
+    }
+}
+
+size_t BinarioCantidad(binario_t binario) {
+    return binario->cantidad;
+}
+
+const binario_registro_t * BinarioRegistros(binario_t binario) {
+    return binario->registros;
+}
+
+const char * BinarioNombre(binario_t binario, size_t fila) {
+    const binario_registro_t * registro = &binario->registros[fila];
+    return Texto(binario, registro->nombre, registro->largo_nombre);
+}
+
+const char * BinarioApellido(binario_t binario, size_t fila) {
+    const binario_registro_t * registro = &binario->registros[fila];
+    return Texto(binario, registro->apellido, registro->largo_apellido);
+}
+
+size_t BinarioBuscarPorDocumento(binario_t binario, uint32_t documento) {
+    if (binario->indice == NULL) {
+        for (size_t fila = 0; fila < binario->cantidad; fila++) {
+            if (binario->registros[fila].documento == documento) {
+                return fila;
+            }
+        }
+        return BINARIO_NINGUNO;
+    }
+
+    size_t inicio = 0;
+    size_t fin = binario->cantidad;
+    while (inicio < fin) {
+        size_t medio = inicio + (fin - inicio) / 2;
+        if (binario->indice[medio].documento < documento) {
+            inicio = medio + 1;
+        } else {
+            fin = medio;
+        }
+    }
+    if ((inicio < binario->cantidad) && (binario->indice[inicio].documento == documento) &&
+        (binario->indice[inicio].fila < binario->cantidad)) {
+        return binario->indice[inicio].fila;
+    }
+    return BINARIO_NINGUNO;
+}
+
+/* === End of documentation ======================================================================================== */
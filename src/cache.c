@@ -0,0 +1,335 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file cache.c
+ ** @brief codigo fuente del módulo de memoria de resultados con reemplazo del menos usado recientemente (LRU)
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "cache.h"
+#include <pthread.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SIN_ENTRADA UINT32_MAX //!< marca de posición libre en el índice y de fin de la lista de uso
+
+#define CAPACIDAD_MAX (UINT32_MAX / 4) //!< cantidad máxima de entradas, para que el índice tenga el doble de lugares
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Entrada de la memoria de resultados.
+ */
+
+struct entrada_s {
+    uint64_t hash;                 //!< dispersión de la clave
+    uint32_t anterior;             //!< entrada usada más recientemente que esta
+    uint32_t siguiente;            //!< entrada usada menos recientemente que esta
+    int resultado;                 //!< resultado guardado
+    uint8_t longitud;              //!< longitud de la clave
+    char clave[CACHE_CLAVE_MAX];   //!< bytes de la clave
+};
+
+/**
+ * @brief Memoria de resultados.
+ *
+ * Las entradas se ubican con un índice de direccionamiento abierto con sondeo lineal, con el doble de lugares que
+ * entradas para que las secuencias de sondeo sean cortas, y se ordenan por uso en una lista doblemente enlazada
+ * por posición dentro del arreglo de entradas.
+ */
+
+struct cache_s {
+    pthread_mutex_t mutex;        //!< protege todos los campos de la memoria
+    uint32_t capacidad;           //!< cantidad máxima de entradas
+    uint32_t usadas;              //!< cantidad de entradas ocupadas
+    uint32_t reciente;            //!< entrada usada más recientemente
+    uint32_t antigua;             //!< entrada usada menos recientemente
+    uint32_t mascara;             //!< cantidad de lugares del índice menos uno
+    uint32_t * indice;            //!< posición de la entrada guardada en cada lugar, o SIN_ENTRADA
+    struct entrada_s * entradas;  //!< arreglo de entradas
+    uint64_t generacion;          //!< cantidad de veces que se vació la memoria
+    uint64_t aciertos;            //!< búsquedas que encontraron su clave
+    uint64_t fallos;              //!< búsquedas que no encontraron su clave
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula la dispersión de una clave procesando ocho bytes por paso.
+ *
+ * @param clave Bytes de la clave.
+ * @param longitud Cantidad de bytes de la clave.
+ * @return Dispersión de 64 bits de la clave.
+ */
+static uint64_t Dispersar(const char * clave, size_t longitud);
+
+/**
+ * @brief Busca el lugar del índice que ocupa una clave.
+ *
+ * @param cache Memoria de resultados.
+ * @param clave Bytes de la clave.
+ * @param longitud Cantidad de bytes de la clave.
+ * @param hash Dispersión de la clave.
+ * @return Lugar del índice donde está la clave, o el lugar libre donde debería insertarse.
+ */
+static uint32_t BuscarLugar(cache_t cache, const char * clave, size_t longitud, uint64_t hash);
+
+/**
+ * @brief Quita una entrada del índice desplazando hacia atrás las que la siguen en su secuencia de sondeo.
+ *
+ * @param cache Memoria de resultados.
+ * @param entrada Posición de la entrada a quitar.
+ */
+static void QuitarDelIndice(cache_t cache, uint32_t entrada);
+
+/**
+ * @brief Quita una entrada de la lista de uso.
+ *
+ * @param cache Memoria de resultados.
+ * @param entrada Posición de la entrada a quitar.
+ */
+static void Desenlazar(cache_t cache, uint32_t entrada);
+
+/**
+ * @brief Agrega una entrada al frente de la lista de uso, como la usada más recientemente.
+ *
+ * @param cache Memoria de resultados.
+ * @param entrada Posición de la entrada a agregar.
+ */
+static void EnlazarAlFrente(cache_t cache, uint32_t entrada);
+
+/**
+ * @brief Calcula la cantidad de lugares del índice para una capacidad.
+ *
+ * @param capacidad Cantidad máxima de entradas.
+ * @return Menor potencia de dos que es al menos el doble de la capacidad.
+ */
+static size_t Lugares(size_t capacidad);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+uint64_t Dispersar(const char * clave, size_t longitud) {
+    uint64_t hash = 0x9E3779B97F4A7C15ull ^ longitud;
+    uint64_t palabra;
+
+    while (longitud >= sizeof(palabra)) {
+        memcpy(&palabra, clave, sizeof(palabra));
+        hash = (hash ^ palabra) * 0xBF58476D1CE4E5B9ull;
+        hash ^= hash >> 29;
+        clave += sizeof(palabra);
+        longitud -= sizeof(palabra);
+    }
+    if (longitud > 0) {
+        palabra = 0;
+        memcpy(&palabra, clave, longitud);
+        hash = (hash ^ palabra) * 0xBF58476D1CE4E5B9ull;
+        hash ^= hash >> 29;
+    }
+
+    hash *= 0x94D049BB133111EBull;
+    return hash ^ (hash >> 31);
+}
+
+uint32_t BuscarLugar(cache_t cache, const char * clave, size_t longitud, uint64_t hash) {
+    uint32_t lugar = (uint32_t)hash & cache->mascara;
+
+    while (cache->indice[lugar] != SIN_ENTRADA) {
+        struct entrada_s * entrada = &cache->entradas[cache->indice[lugar]];
+        if ((entrada->hash == hash) && (entrada->longitud == longitud) && !memcmp(entrada->clave, clave, longitud)) {
+            break;
+        }
+        lugar = (lugar + 1) & cache->mascara;
+    }
+    return lugar;
+}
+
+void QuitarDelIndice(cache_t cache, uint32_t entrada) {
+    uint32_t hueco = (uint32_t)cache->entradas[entrada].hash & cache->mascara;
+    while (cache->indice[hueco] != entrada) {
+        hueco = (hueco + 1) & cache->mascara;
+    }
+
+    for (uint32_t lugar = (hueco + 1) & cache->mascara; cache->indice[lugar] != SIN_ENTRADA;
+         lugar = (lugar + 1) & cache->mascara) {
+        uint32_t ideal = (uint32_t)cache->entradas[cache->indice[lugar]].hash & cache->mascara;
+        if (((lugar - ideal) & cache->mascara) >= ((lugar - hueco) & cache->mascara)) {
+            cache->indice[hueco] = cache->indice[lugar];
+            hueco = lugar;
+        }
+    }
+    cache->indice[hueco] = SIN_ENTRADA;
+}
+
+void Desenlazar(cache_t cache, uint32_t entrada) {
+    struct entrada_s * actual = &cache->entradas[entrada];
+
+    if (actual->anterior != SIN_ENTRADA) {
+        cache->entradas[actual->anterior].siguiente = actual->siguiente;
+    } else {
+        cache->reciente = actual->siguiente;
+    }
+    if (actual->siguiente != SIN_ENTRADA) {
+        cache->entradas[actual->siguiente].anterior = actual->anterior;
+    } else {
+        cache->antigua = actual->anterior;
+    }
+}
+
+void EnlazarAlFrente(cache_t cache, uint32_t entrada) {
+    struct entrada_s * actual = &cache->entradas[entrada];
+
+    actual->anterior = SIN_ENTRADA;
+    actual->siguiente = cache->reciente;
+    if (cache->reciente != SIN_ENTRADA) {
+        cache->entradas[cache->reciente].anterior = entrada;
+    } else {
+        cache->antigua = entrada;
+    }
+    cache->reciente = entrada;
+}
+
+size_t Lugares(size_t capacidad) {
+    size_t lugares = 2;
+
+    while (lugares < 2 * capacidad) {
+        lugares *= 2;
+    }
+    return lugares;
+}
+
+/* === Public function implementation ============================================================================== */
+
+size_t CacheTamano(size_t capacidad) {
+    if ((capacidad == 0) || (capacidad > CAPACIDAD_MAX)) {
+        return 0;
+    }
+
+    return sizeof(struct cache_s) + capacidad * sizeof(struct entrada_s) + Lugares(capacidad) * sizeof(uint32_t);
+}
+
+cache_t CacheIniciar(void * memoria, size_t capacidad) {
+    if (!memoria || !CacheTamano(capacidad)) {
+        return NULL;
+    }
+
+    cache_t cache = memoria;
+    pthread_mutex_init(&cache->mutex, NULL);
+    cache->capacidad = (uint32_t)capacidad;
+    cache->mascara = (uint32_t)(Lugares(capacidad) - 1);
+    cache->entradas = (struct entrada_s *)(cache + 1);
+    cache->indice = (uint32_t *)(cache->entradas + capacidad);
+    cache->generacion = 0;
+    cache->aciertos = 0;
+    cache->fallos = 0;
+    CacheVaciar(cache);
+    return cache;
+}
+
+void CacheFinalizar(cache_t cache) {
+    if (cache) {
+        pthread_mutex_destroy(&cache->mutex);
+    }
+}
+
+bool CacheBuscar(cache_t cache, const char * clave, size_t longitud, int * resultado, uint64_t * generacion) {
+    bool encontrada = false;
+
+    pthread_mutex_lock(&cache->mutex);
+    *generacion = cache->generacion;
+    if (longitud <= CACHE_CLAVE_MAX) {
+        uint32_t entrada = cache->indice[BuscarLugar(cache, clave, longitud, Dispersar(clave, longitud))];
+        if (entrada != SIN_ENTRADA) {
+            *resultado = cache->entradas[entrada].resultado;
+            Desenlazar(cache, entrada);
+            EnlazarAlFrente(cache, entrada);
+            encontrada = true;
+        }
+    }
+    if (encontrada) {
+        cache->aciertos++;
+    } else {
+        cache->fallos++;
+    }
+    pthread_mutex_unlock(&cache->mutex);
+
+    return encontrada;
+}
+
+void CacheGuardar(cache_t cache, const char * clave, size_t longitud, int resultado, uint64_t generacion) {
+    if (longitud > CACHE_CLAVE_MAX) {
+        return;
+    }
+
+    uint64_t hash = Dispersar(clave, longitud);
+    pthread_mutex_lock(&cache->mutex);
+    if (generacion == cache->generacion) {
+        uint32_t lugar = BuscarLugar(cache, clave, longitud, hash);
+        uint32_t entrada = cache->indice[lugar];
+
+        if (entrada != SIN_ENTRADA) {
+            // Otro hilo guardó la misma clave mientras se calculaba el resultado
+            Desenlazar(cache, entrada);
+        } else {
+            if (cache->usadas < cache->capacidad) {
+                entrada = cache->usadas++;
+            } else {
+                entrada = cache->antigua;
+                Desenlazar(cache, entrada);
+                QuitarDelIndice(cache, entrada);
+                lugar = BuscarLugar(cache, clave, longitud, hash);
+            }
+            cache->entradas[entrada].hash = hash;
+            cache->entradas[entrada].longitud = (uint8_t)longitud;
+            memcpy(cache->entradas[entrada].clave, clave, longitud);
+            cache->indice[lugar] = entrada;
+        }
+        cache->entradas[entrada].resultado = resultado;
+        EnlazarAlFrente(cache, entrada);
+    }
+    pthread_mutex_unlock(&cache->mutex);
+}
+
+void CacheVaciar(cache_t cache) {
+    pthread_mutex_lock(&cache->mutex);
+    memset(cache->indice, 0xFF, ((size_t)cache->mascara + 1) * sizeof(uint32_t));
+    cache->usadas = 0;
+    cache->reciente = SIN_ENTRADA;
+    cache->antigua = SIN_ENTRADA;
+    cache->generacion++;
+    pthread_mutex_unlock(&cache->mutex);
+}
+
+void CacheEstadisticas(cache_t cache, uint64_t * aciertos, uint64_t * fallos) {
+    pthread_mutex_lock(&cache->mutex);
+    if (aciertos) {
+        *aciertos = cache->aciertos;
+    }
+    if (fallos) {
+        *fallos = cache->fallos;
+    }
+    pthread_mutex_unlock(&cache->mutex);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -24,14 +24,58 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "calculadora.h"
+#include "arena.h"
+#include "cache.h"
+#include "config.h"
+#include "conversion.h"
+#include "medicion.h"
+#include "paralelo.h"
+#include "vector.h"
+#include <ctype.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <stdio.h>
 
 /* === Macros definitions ========================================================================================== */
 
+#define OPERADORES_CANTIDAD (UCHAR_MAX + 1) //!< cantidad de entradas de la tabla de despacho, una por carácter
+
+#define INSTRUCCIONES_LOCALES 128 //!< instrucciones que CalculadoraCalcula compila antes de ejecutarlas
+
+#define LOTE_BLOQUE 256 //!< expresiones que un hilo evalúa de una vez en CalculadoraCalculaLote
+
+#define REDUCCION_PORCIONES 1024 //!< cantidad máxima de resultados parciales en CalculadoraReducir
+
+#define REDUCCION_BLOQUE_MIN 16384 //!< elementos mínimos de cada porción que reduce un hilo en CalculadoraReducir
+
+#define PRECEDENCIA_ADITIVA 1 //!< precedencia predeterminada de las operaciones registradas
+
+#define PRECEDENCIA_MULTIPLICATIVA 2 //!< precedencia predeterminada de OperacionMul y OperacionDiv
+
 /* === Private data type declarations ============================================================================== */
 
+/**
+ * @brief Códigos de las instrucciones de un programa compilado.
+ *
+ * Las operaciones incluidas en el módulo tienen su propio código para que el intérprete las resuelva sin llamar a
+ * través de un puntero a función; el resto de las operaciones registradas usan `INSTRUCCION_LLAMAR`.
+ */
+
+typedef enum instruccion_codigo_e {
+    INSTRUCCION_CONSTANTE,    /**< Apila el valor constante de la instrucción. */
+    INSTRUCCION_PARAMETRO,    /**< Apila el parámetro cuyo índice indica la instrucción. */
+    INSTRUCCION_NEGAR,        /**< Cambia el signo del valor en el tope de la pila. */
+    INSTRUCCION_SUMAR,        /**< Suma los dos valores del tope de la pila. */
+    INSTRUCCION_RESTAR,       /**< Resta los dos valores del tope de la pila. */
+    INSTRUCCION_MULTIPLICAR,  /**< Multiplica los dos valores del tope de la pila. */
+    INSTRUCCION_DIVIDIR,      /**< Divide los dos valores del tope de la pila. */
+    INSTRUCCION_LLAMAR,       /**< Aplica la función de la instrucción a los dos valores del tope de la pila. */
+} instruccion_codigo_t;
+
 /**
  * @brief Estructura interna para representar una operación matemática.
  */
@@ -39,42 +83,810 @@ SPDX-License-Identifier: MIT
 typedef struct operacion_s * operacion_t; 
 
 struct operacion_s {
-    char operador;            /**< Símbolo que representa la operación, por ejemplo '+', '-' o '*'. */
-    operacion_func_t funcion; /**< Función que implementa la operación. */
-    operacion_t siguiente;     /**< Puntero a la siguiente operación en la lista. */
+    operacion_func_t funcion; /**< Función que implementa la operación, NULL si el operador no está registrado. */
+    int precedencia;          /**< Precedencia del operador, mayor valor se evalúa antes. */
+    bool derecha;             /**< true si el operador es asociativo a derecha. */
+    bool asociativa;          /**< true si la operación cumple (a op b) op c == a op (b op c). */
+    bool conmutativa;         /**< true si la operación cumple a op b == b op a. */
+    uint8_t codigo;           /**< Instrucción que se emite al compilar el operador. */
+    unsigned char simbolo;    /**< Carácter del operador, que se guarda en las instrucciones emitidas. */
+};
+
+/**
+ * @brief Tabla de despacho de operaciones.
+ *
+ * Cada calculadora tiene una única tabla de punteros a operaciones. Una operación publicada nunca se modifica ni se
+ * reemplaza, porque un operador no puede registrarse dos veces: registrar una operación solo completa una entrada
+ * nueva y publica su puntero en forma atómica, de modo que los hilos que evalúan expresiones leen la tabla sin
+ * bloqueos y no hay copias de la tabla que recuperar. La tabla ocupa un puntero por carácter y cada operación
+ * registrada suma una `struct operacion_s`.
+ */
+
+typedef struct tabla_s * tabla_t;
+
+struct tabla_s {
+    _Atomic(operacion_t) operaciones[OPERADORES_CANTIDAD]; /**< Operación de cada carácter, o NULL. */
+};
+
+/**
+ * @brief Instrucción de un programa compilado.
+ */
+
+struct instruccion_s {
+    uint8_t codigo;           /**< Código de la instrucción, uno de `instruccion_codigo_t`. */
+    int valor;                /**< Constante, índice de parámetro o carácter del operador, según el código. */
+    operacion_func_t funcion; /**< Función a aplicar en las instrucciones `INSTRUCCION_LLAMAR`. */
+};
+
+/**
+ * @brief Programa compilado a partir de una expresión.
+ *
+ * Las instrucciones forman un arreglo contiguo en notación postfija que el intérprete recorre una sola vez usando
+ * una pila de tamaño fijo, sin recursión ni memoria dinámica.
+ */
+
+struct programa_s {
+    struct instruccion_s * instrucciones; /**< Arreglo de instrucciones del programa. */
+    int longitud;                         /**< Cantidad de instrucciones del programa. */
+    int capacidad;                        /**< Cantidad de instrucciones que entran en el arreglo. */
+    int parametros;                       /**< Cantidad de valores que necesita el programa al evaluarse. */
+    programa_t anterior;                  /**< Programa anterior en la lista de programas de la calculadora. */
+    programa_t siguiente;                 /**< Siguiente programa en la lista de programas de la calculadora. */
 };
 
+/**
+ * @brief Tipos de elementos que el compilador deja pendientes en su pila de operadores.
+ */
+
+typedef enum pendiente_tipo_e {
+    PENDIENTE_PARENTESIS, /**< Paréntesis abierto. */
+    PENDIENTE_NEGACION,   /**< Signo menos unario. */
+    PENDIENTE_BINARIO,    /**< Operador binario registrado. */
+} pendiente_tipo_t;
+
+/**
+ * @brief Operador pendiente de emitir durante la compilación.
+ */
+
+struct pendiente_s {
+    pendiente_tipo_t tipo; /**< Tipo de elemento pendiente. */
+    operacion_t operacion; /**< Operación, solo para los operadores binarios. */
+};
+
+/**
+ * @brief Evaluación de un texto que se ejecuta por tramos mientras se compila.
+ *
+ * CalculadoraCalcula compila en un arreglo local de INSTRUCCIONES_LOCALES instrucciones; cuando se llena, las
+ * instrucciones emitidas se ejecutan sobre esta pila y el arreglo se reutiliza, de modo que la longitud de la
+ * expresión no depende de la memoria disponible.
+ */
+
+struct evaluacion_s {
+    int pila[CALCULADORA_PILA_MAX]; /**< Pila de evaluación que se conserva entre tramos. */
+    int * tope;                     /**< Último valor de la pila, o una posición antes de su inicio si está vacía. */
+    medicion_hilo_t medicion;       /**< Contadores del hilo, o NULL. */
+    calculadora_estado_t estado;    /**< Primer error de ejecución encontrado, o CALCULADORA_CORRECTO. */
+};
+
+/**
+ * @brief Estado del compilador de expresiones.
+ */
+
+typedef struct compilador_s {
+    tabla_t tabla;                                    /**< Tabla de operaciones con la que se compila. */
+    programa_t programa;                              /**< Programa en construcción. */
+    calculadora_resolver_t resolver;                  /**< Traduce nombres a parámetros, o NULL para usar letras. */
+    void * contexto;                                  /**< Puntero que se pasa sin cambios al resolver. */
+    struct evaluacion_s * evaluacion;                 /**< Evaluación por tramos, o NULL si el programa se guarda. */
+    int profundidad;                                  /**< Valores en la pila de evaluación tras lo emitido. */
+    int pendientes;                                   /**< Cantidad de operadores pendientes. */
+    struct pendiente_s pila[CALCULADORA_PILA_MAX];    /**< Pila de operadores pendientes. */
+} * compilador_t;
+
+/**
+ * @brief Lote de expresiones que se reparte entre los hilos en CalculadoraCalculaLote.
+ */
+
+struct lote_s {
+    calculadora_t calculadora;         /**< Calculadora con las operaciones registradas. */
+    const char * const * expresiones;  /**< Expresiones a evaluar. */
+    int * resultados;                  /**< Resultado de cada expresión. */
+};
+
+/**
+ * @brief Reducción de un arreglo que se reparte entre los hilos en CalculadoraReducir.
+ */
+
+struct reduccion_s {
+    operacion_t operacion;                 /**< Operación asociativa con la que se reduce. */
+    const int * valores;                   /**< Arreglo a reducir. */
+    size_t cantidad;                       /**< Cantidad de elementos del arreglo. */
+    size_t bloque;                         /**< Cantidad de elementos de cada porción. */
+    int parciales[REDUCCION_PORCIONES];    /**< Resultado de la reducción de cada porción. */
+};
+
+/**
+ * @brief Estructura interna de la calculadora.
+ *
+ * Las operaciones se guardan en una tabla de despacho indexada directamente por el carácter del operador, de modo
+ * que la búsqueda es de tiempo constante y la tabla completa ocupa un bloque contiguo de punteros. La evaluación solo
+ * lee las entradas publicadas; las modificaciones se serializan con el mutex de escritura. Si la calculadora se creó
+ * en una arena, la calculadora, su tabla, sus operaciones, sus programas y su memoria de resultados se asignan de
+ * ella y no se liberan uno por uno.
+ */
+
 struct calculadora_s {
-    operacion_t operaciones; //<! lista de operaciones
+    arena_t arena;            //<! arena de la que se asigna la memoria, o NULL si se usa malloc
+    tabla_t tabla;            //<! tabla de despacho de operaciones
+    pthread_mutex_t escritura; //<! serializa el registro de operaciones y de programas
+    programa_t programas;     //<! lista de programas compilados por la calculadora
+    cache_t cache;            //<! memoria de resultados, NULL si está deshabilitada
+    _Atomic uint64_t errores[CALCULADORA_ESTADOS]; //<! cantidad de errores encontrados de cada tipo
+#ifdef USAR_INSTRUMENTACION
+    medicion_t medicion;      //<! llamadas, errores y latencias contadas por cada hilo
+#endif
+#ifdef CALCULADORA_USAR_MEMORIA_ESTATICA
+    int instancia;            //<! posición de la memoria estática que ocupa la calculadora, o -1 si no ocupa ninguna
+#endif
 };
 
 /* === Private function declarations =============================================================================== */
 
 /**
- * @brief Busca una operación registrada en la calculadora por su símbolo.
+ * @brief Crea una calculadora sin operaciones registradas.
+ *
+ * @param arena Arena de la que se asigna toda la memoria de la calculadora, o NULL para usar malloc.
+ * @return Calculadora creada, o NULL si no se pudo asignar memoria.
+ */
+
+static calculadora_t CrearCalculadora(arena_t arena);
+
+/**
+ * @brief Asigna memoria para la calculadora, de su arena si tiene una o con malloc en caso contrario.
+ *
+ * @param calculadora Calculadora que usará la memoria.
+ * @param tamano Cantidad de bytes a asignar.
+ * @return Puntero al bloque asignado, o NULL si no hay memoria suficiente.
+ */
+
+static void * Asignar(calculadora_t calculadora, size_t tamano);
+
+/**
+ * @brief Libera un bloque obtenido con Asignar.
+ *
+ * En una arena el bloque solo se recupera si fue el último asignado y se conoce su tamaño; en otro caso queda
+ * ocupado hasta reiniciar la arena.
+ *
+ * @param calculadora Calculadora que usaba la memoria.
+ * @param bloque Bloque a liberar, puede ser NULL.
+ * @param tamano Cantidad de bytes con la que se asignó el bloque, o 0 si no se conoce.
+ */
+
+static void Liberar(calculadora_t calculadora, void * bloque, size_t tamano);
+
+/**
+ * @brief Obtiene la tabla de operaciones de la calculadora.
  *
  * @param calculadora Puntero a la calculadora.
+ * @return Tabla de operaciones, que no se reemplaza ni se libera mientras exista la calculadora.
+ */
+
+static tabla_t LeerTabla(calculadora_t calculadora);
+
+/**
+ * @brief Busca una operación registrada en una tabla por su símbolo.
+ *
+ * @param tabla Tabla de operaciones.
  * @param operador Símbolo de la operación a buscar.
  * @return Puntero a la operación encontrada, o NULL si no existe.
  */
 
-static operacion_t EncontrarOperacion(calculadora_t calculadora, char operador);
+static operacion_t EncontrarOperacion(tabla_t tabla, char operador);
+
+/**
+ * @brief Agrega una instrucción al programa en construcción, controlando la profundidad de la pila de evaluación.
+ *
+ * @param compilador Estado del compilador.
+ * @param codigo Código de la instrucción.
+ * @param valor Constante o índice de parámetro de la instrucción.
+ * @param funcion Función de la instrucción, solo para `INSTRUCCION_LLAMAR`.
+ * @return true si la instrucción se agregó, false si el programa no tiene espacio o la pila se desborda.
+ */
+
+static bool Emitir(compilador_t compilador, instruccion_codigo_t codigo, int valor, operacion_func_t funcion);
+
+/**
+ * @brief Emite la instrucción correspondiente a un operador pendiente.
+ *
+ * @param compilador Estado del compilador.
+ * @param pendiente Operador pendiente a emitir.
+ * @return true si la instrucción se agregó, false en caso contrario.
+ */
+
+static bool EmitirPendiente(compilador_t compilador, const struct pendiente_s * pendiente);
+
+/**
+ * @brief Ejecuta las instrucciones emitidas hasta el momento y vacía el programa para seguir compilando.
+ *
+ * Después del primer error de ejecución, o si el programa usa parámetros, las instrucciones se descartan sin
+ * ejecutarlas; el error se informa solo si el resto de la expresión compila sin errores.
+ *
+ * @param compilador Estado del compilador con el programa lleno.
+ * @return true si se vació el programa, false si el compilador no evalúa por tramos.
+ */
+
+static bool Adelantar(compilador_t compilador);
+
+/**
+ * @brief Compila una expresión en un programa, recorriendo el texto una sola vez.
+ *
+ * Usa el algoritmo de playa de maniobras (shunting-yard) respetando la precedencia y la asociatividad de cada
+ * operación registrada. Admite espacios, paréntesis, signo menos unario y parámetros: de la 'a' a la 'z' si no hay
+ * resolver, o nombres de letras, dígitos y '_' que traduce el resolver.
+ *
+ * @param calculadora Calculadora con las operaciones registradas.
+ * @param expresion Texto de la expresión a compilar, no necesita terminar en '\0'.
+ * @param longitud Cantidad de caracteres de la expresión.
+ * @param programa Programa donde se guarda el resultado, con su arreglo de instrucciones ya asignado.
+ * @param resolver Función que traduce los nombres a índices de parámetros, o NULL.
+ * @param contexto Puntero que se pasa sin cambios al resolver.
+ * @param evaluacion Evaluación donde se ejecutan las instrucciones que no caben en el programa, o NULL para que la
+ *                   expresión sea inválida si no caben.
+ * @return CALCULADORA_CORRECTO si la expresión es válida y todos sus operadores están registrados, o el estado que
+ *         describe el error.
+ */
+
+static calculadora_estado_t CompilarExpresion(calculadora_t calculadora, const char * expresion, size_t longitud,
+                                              programa_t programa, calculadora_resolver_t resolver, void * contexto,
+                                              struct evaluacion_s * evaluacion);
+
+/**
+ * @brief Indica si un carácter puede formar parte de un nombre en una tabla de operaciones.
+ *
+ * @param tabla Tabla de operaciones.
+ * @param caracter Carácter a analizar.
+ * @param inicial true si es el primer carácter del nombre, que no puede ser un dígito.
+ * @return true si el carácter es una letra, un '_' o un dígito no inicial y no está registrado como operador.
+ */
+
+static bool EsNombre(tabla_t tabla, char caracter, bool inicial);
+
+/**
+ * @brief Ejecuta un programa compilado.
+ *
+ * Las instrucciones de las operaciones incluidas controlan el desbordamiento y la división por cero, y la ejecución
+ * se detiene en el primer error.
+ *
+ * @param programa Programa a ejecutar.
+ * @param valores Valores de los parámetros del programa.
+ * @param resultado Variable donde se guarda el resultado de la expresión.
+ * @param medicion Contadores del hilo donde se registra cada operador aplicado, o NULL para no registrarlos.
+ * @return CALCULADORA_CORRECTO, CALCULADORA_DIVISION_POR_CERO o CALCULADORA_DESBORDAMIENTO.
+ */
+
+static calculadora_estado_t EjecutarPrograma(const struct programa_s * programa, const int valores[],
+                                             int * resultado, medicion_hilo_t medicion);
+
+/**
+ * @brief Ejecuta las instrucciones de un programa sobre una pila de evaluación que puede tener valores previos.
+ *
+ * @param programa Programa cuyas instrucciones se ejecutan.
+ * @param valores Valores de los parámetros del programa.
+ * @param cima Último valor de la pila, que se actualiza si la ejecución termina sin errores.
+ * @param medicion Contadores del hilo donde se registra cada operador aplicado, o NULL para no registrarlos.
+ * @return CALCULADORA_CORRECTO, CALCULADORA_DIVISION_POR_CERO o CALCULADORA_DESBORDAMIENTO.
+ */
+
+static calculadora_estado_t EjecutarInstrucciones(const struct programa_s * programa, const int valores[], int ** cima,
+                                                  medicion_hilo_t medicion);
+
+/**
+ * @brief Termina la ejecución de un programa por un error en una instrucción.
+ *
+ * Con la instrumentación habilitada, el error se cuenta para el operador de la instrucción.
+ *
+ * @param instruccion Instrucción que falló.
+ * @param medicion Contadores del hilo, o NULL.
+ * @param estado Estado que describe el error.
+ * @return El mismo estado recibido.
+ */
+
+static calculadora_estado_t FallarInstruccion(const struct instruccion_s * instruccion, medicion_hilo_t medicion,
+                                              calculadora_estado_t estado);
+
+/**
+ * @brief Cuenta un error en la calculadora.
+ *
+ * @param calculadora Calculadora en la que ocurrió la evaluación.
+ * @param estado Estado de la evaluación; CALCULADORA_CORRECTO no se cuenta.
+ * @return El mismo estado recibido.
+ */
+
+static calculadora_estado_t RegistrarEstado(calculadora_t calculadora, calculadora_estado_t estado);
+
+/**
+ * @brief Evalúa las expresiones [inicio, fin) de un lote.
+ *
+ * @param contexto Puntero a la estructura lote_s con las expresiones.
+ * @param inicio Primera expresión a evaluar.
+ * @param fin Expresión siguiente a la última a evaluar.
+ */
+
+static void CalcularLote(void * contexto, size_t inicio, size_t fin);
+
+/**
+ * @brief Compila y ejecuta una expresión sin consultar la memoria de resultados.
+ *
+ * La expresión se ejecuta por tramos de INSTRUCCIONES_LOCALES instrucciones mientras se compila, así que no se pide
+ * memoria y la longitud de la expresión no está limitada.
+ *
+ * @param calculadora Calculadora con las operaciones registradas.
+ * @param expresion Texto de la expresión a evaluar.
+ * @param longitud Cantidad de caracteres de la expresión.
+ * @param resultado Variable donde se guarda el resultado de la expresión.
+ * @param medicion Contadores del hilo, o NULL.
+ * @return CALCULADORA_CORRECTO si la expresión se evaluó, o el estado que describe el error.
+ */
+
+static calculadora_estado_t CalcularTexto(calculadora_t calculadora, const char * expresion, size_t longitud,
+                                          int * resultado, medicion_hilo_t medicion);
+
+/**
+ * @brief Reduce en orden los elementos de un arreglo no vacío con una operación.
+ *
+ * Las operaciones incluidas que están marcadas como asociativas y conmutativas se reducen con las implementaciones
+ * SIMD del módulo vector; las demás se pliegan de izquierda a derecha.
+ *
+ * @param operacion Operación con la que se reduce.
+ * @param valores Arreglo a reducir.
+ * @param cantidad Cantidad de elementos del arreglo, al menos uno.
+ * @return Resultado de la reducción.
+ */
+
+static int ReducirSecuencial(operacion_t operacion, const int valores[], size_t cantidad);
+
+/**
+ * @brief Reduce las porciones [inicio, fin) de una reducción paralela.
+ *
+ * @param contexto Puntero a la estructura reduccion_s.
+ * @param inicio Primera porción a reducir.
+ * @param fin Porción siguiente a la última a reducir.
+ */
+
+static void ReducirPorciones(void * contexto, size_t inicio, size_t fin);
 
 /* === Private variable definitions ================================================================================ */
 
+#ifdef CALCULADORA_USAR_MEMORIA_ESTATICA
+
+//! Memoria de la que se asigna todo lo que usa cada calculadora
+static _Alignas(max_align_t) unsigned char memorias[CALCULADORA_MAX][CALCULADORA_MEMORIA];
+
+static atomic_bool ocupadas[CALCULADORA_MAX]; //!< Indica si la memoria de cada calculadora está en uso
+
+static arena_t arenas[CALCULADORA_MAX]; //!< arena de cada memoria, creada la primera vez que se usa la memoria
+
+#endif
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
-static operacion_t EncontrarOperacion(calculadora_t calculadora, char operador) {
-    operacion_t actual = calculadora->operaciones;
-    while (actual != NULL) {
-        if (actual->operador == operador) {
-            return actual;
+static calculadora_t CrearCalculadora(arena_t arena) {
+    calculadora_t nueva_calculadora;
+    tabla_t tabla;
+
+    if (arena) {
+        nueva_calculadora = ArenaAsignar(arena, sizeof(struct calculadora_s));
+        tabla = ArenaAsignar(arena, sizeof(struct tabla_s));
+        if (!nueva_calculadora || !tabla) {
+            ArenaDevolver(arena, tabla, sizeof(struct tabla_s));
+            ArenaDevolver(arena, nueva_calculadora, sizeof(struct calculadora_s));
+            return NULL;
+        }
+    } else {
+#ifdef CALCULADORA_USAR_MEMORIA_ESTATICA
+        return NULL;
+#else
+        nueva_calculadora = malloc(sizeof(struct calculadora_s));
+        tabla = malloc(sizeof(struct tabla_s));
+        if (!nueva_calculadora || !tabla) {
+            free(nueva_calculadora);
+            free(tabla);
+            return NULL;
         }
-        actual = actual->siguiente;
+#endif
+    }
+
+    nueva_calculadora->arena = arena;
+#ifdef CALCULADORA_USAR_MEMORIA_ESTATICA
+    nueva_calculadora->instancia = -1; // CalculadoraCrear la reemplaza; en una arena provista no hay bloque propio
+#endif
+    for (int operador = 0; operador < OPERADORES_CANTIDAD; operador++) {
+        atomic_init(&tabla->operaciones[operador], NULL);
+    }
+    nueva_calculadora->tabla = tabla;
+    pthread_mutex_init(&nueva_calculadora->escritura, NULL);
+    nueva_calculadora->programas = NULL;
+    nueva_calculadora->cache = NULL;
+    for (int estado = 0; estado < CALCULADORA_ESTADOS; estado++) {
+        atomic_init(&nueva_calculadora->errores[estado], 0);
+    }
+#ifdef USAR_INSTRUMENTACION
+    nueva_calculadora->medicion = MedicionCrear();
+    if (!nueva_calculadora->medicion) {
+        CalculadoraDestruir(nueva_calculadora);
+        return NULL;
+    }
+#endif
+    return nueva_calculadora;
+}
+
+static void * Asignar(calculadora_t calculadora, size_t tamano) {
+#ifdef CALCULADORA_USAR_MEMORIA_ESTATICA
+    return ArenaAsignar(calculadora->arena, tamano);
+#else
+    return calculadora->arena ? ArenaAsignar(calculadora->arena, tamano) : malloc(tamano);
+#endif
+}
+
+static void Liberar(calculadora_t calculadora, void * bloque, size_t tamano) {
+    if (calculadora->arena) {
+        if (tamano > 0) {
+            ArenaDevolver(calculadora->arena, bloque, tamano);
+        }
+    } else {
+#ifndef CALCULADORA_USAR_MEMORIA_ESTATICA
+        free(bloque);
+#endif
+    }
+}
+
+static tabla_t LeerTabla(calculadora_t calculadora) {
+    return calculadora->tabla;
+}
+
+static operacion_t EncontrarOperacion(tabla_t tabla, char operador) {
+    return atomic_load_explicit(&tabla->operaciones[(unsigned char)operador], memory_order_acquire);
+}
+
+static bool Emitir(compilador_t compilador, instruccion_codigo_t codigo, int valor, operacion_func_t funcion) {
+    programa_t programa = compilador->programa;
+
+    if ((programa->longitud >= programa->capacidad) && !Adelantar(compilador)) {
+        return false;
+    }
+
+    if ((codigo == INSTRUCCION_CONSTANTE) || (codigo == INSTRUCCION_PARAMETRO)) {
+        compilador->profundidad++;
+        if (compilador->profundidad > CALCULADORA_PILA_MAX) {
+            return false;
+        }
+    } else if (codigo != INSTRUCCION_NEGAR) {
+        compilador->profundidad--;
+    }
+
+    struct instruccion_s * instruccion = &programa->instrucciones[programa->longitud++];
+    instruccion->codigo = codigo;
+    instruccion->valor = valor;
+    instruccion->funcion = funcion;
+    return true;
+}
+
+static bool EmitirPendiente(compilador_t compilador, const struct pendiente_s * pendiente) {
+    if (pendiente->tipo == PENDIENTE_NEGACION) {
+        return Emitir(compilador, INSTRUCCION_NEGAR, 0, NULL);
+    }
+    return Emitir(compilador, pendiente->operacion->codigo, pendiente->operacion->simbolo,
+                  pendiente->operacion->funcion);
+}
+
+static bool Adelantar(compilador_t compilador) {
+    struct evaluacion_s * evaluacion = compilador->evaluacion;
+    programa_t programa = compilador->programa;
+
+    if (!evaluacion) {
+        return false;
+    }
+    if ((evaluacion->estado == CALCULADORA_CORRECTO) && (programa->parametros == 0)) {
+        evaluacion->estado = EjecutarInstrucciones(programa, NULL, &evaluacion->tope, evaluacion->medicion);
+    }
+    programa->longitud = 0;
+    return true;
+}
+
+static bool EsNombre(tabla_t tabla, char caracter, bool inicial) {
+    unsigned char simbolo = (unsigned char)caracter;
+    bool valido = isalpha(simbolo) || (simbolo == '_') || (!inicial && isdigit(simbolo));
+    return valido && !EncontrarOperacion(tabla, caracter);
+}
+
+static calculadora_estado_t CompilarExpresion(calculadora_t calculadora, const char * expresion, size_t longitud,
+                                              programa_t programa, calculadora_resolver_t resolver, void * contexto,
+                                              struct evaluacion_s * evaluacion) {
+    struct compilador_s compilador = {
+        .tabla = LeerTabla(calculadora),
+        .programa = programa,
+        .resolver = resolver,
+        .contexto = contexto,
+        .evaluacion = evaluacion,
+    };
+    bool esperando_operando = true;
+    const char * cursor = expresion;
+    const char * fin = expresion + longitud;
+    int valor;
+
+    programa->longitud = 0;
+    programa->parametros = 0;
+
+    while (true) {
+        while ((cursor < fin) && isspace((unsigned char)*cursor)) {
+            cursor++;
+        }
+        if (cursor == fin) {
+            break;
+        }
+        char caracter = *cursor;
+
+        if (esperando_operando) {
+            bool digito_siguiente = (cursor + 1 < fin) && isdigit((unsigned char)cursor[1]);
+            if ((caracter == '(') || ((caracter == '-') && !digito_siguiente)) {
+                if (compilador.pendientes >= CALCULADORA_PILA_MAX) {
+                    return CALCULADORA_EXPRESION_INVALIDA;
+                }
+                compilador.pila[compilador.pendientes++].tipo =
+                    (caracter == '(') ? PENDIENTE_PARENTESIS : PENDIENTE_NEGACION;
+                cursor++;
+            } else if (caracter == '+') {
+                cursor++;
+            } else if ((caracter == '-') || isdigit((unsigned char)caracter)) {
+                cursor = ConversionTextoAEntero(cursor, fin, &valor);
+                if (!cursor) {
+                    return CALCULADORA_DESBORDAMIENTO; // Hay al menos un dígito, solo puede fallar por desbordamiento
+                }
+                if (!Emitir(&compilador, INSTRUCCION_CONSTANTE, valor, NULL)) {
+                    return CALCULADORA_EXPRESION_INVALIDA;
+                }
+                esperando_operando = false;
+            } else if (compilador.resolver ? EsNombre(compilador.tabla, caracter, true)
+                                           : ((caracter >= 'a') && (caracter <= 'z') &&
+                                              !EncontrarOperacion(compilador.tabla, caracter))) {
+                const char * nombre = cursor++;
+                if (compilador.resolver) {
+                    while ((cursor < fin) && EsNombre(compilador.tabla, *cursor, false)) {
+                        cursor++;
+                    }
+                    valor = compilador.resolver(compilador.contexto, nombre, (size_t)(cursor - nombre));
+                } else {
+                    valor = caracter - 'a';
+                }
+                if ((valor < 0) || !Emitir(&compilador, INSTRUCCION_PARAMETRO, valor, NULL)) {
+                    return CALCULADORA_EXPRESION_INVALIDA; // Error: nombre desconocido o expresión demasiado profunda
+                }
+                if (valor >= programa->parametros) {
+                    programa->parametros = valor + 1;
+                }
+                esperando_operando = false;
+            } else if ((caracter == ')') || EncontrarOperacion(compilador.tabla, caracter)) {
+                return CALCULADORA_EXPRESION_INVALIDA; // Error: falta un operando
+            } else {
+                return CALCULADORA_OPERADOR_DESCONOCIDO;
+            }
+        } else if (caracter == ')') {
+            while ((compilador.pendientes > 0) &&
+                   (compilador.pila[compilador.pendientes - 1].tipo != PENDIENTE_PARENTESIS)) {
+                if (!EmitirPendiente(&compilador, &compilador.pila[--compilador.pendientes])) {
+                    return CALCULADORA_EXPRESION_INVALIDA;
+                }
+            }
+            if (compilador.pendientes == 0) {
+                return CALCULADORA_EXPRESION_INVALIDA; // Error: paréntesis de cierre sin apertura
+            }
+            compilador.pendientes--;
+            cursor++;
+        } else {
+            operacion_t operacion = EncontrarOperacion(compilador.tabla, caracter);
+            if (!operacion) {
+                if ((caracter == '(') || isdigit((unsigned char)caracter)) {
+                    return CALCULADORA_EXPRESION_INVALIDA; // Error: dos operandos seguidos
+                }
+                return CALCULADORA_OPERADOR_DESCONOCIDO;
+            }
+            while (compilador.pendientes > 0) {
+                struct pendiente_s * tope = &compilador.pila[compilador.pendientes - 1];
+                if ((tope->tipo == PENDIENTE_PARENTESIS) ||
+                    ((tope->tipo == PENDIENTE_BINARIO) &&
+                     ((tope->operacion->precedencia < operacion->precedencia) ||
+                      ((tope->operacion->precedencia == operacion->precedencia) && operacion->derecha)))) {
+                    break;
+                }
+                compilador.pendientes--;
+                if (!EmitirPendiente(&compilador, tope)) {
+                    return CALCULADORA_EXPRESION_INVALIDA;
+                }
+            }
+            if (compilador.pendientes >= CALCULADORA_PILA_MAX) {
+                return CALCULADORA_EXPRESION_INVALIDA;
+            }
+            compilador.pila[compilador.pendientes].tipo = PENDIENTE_BINARIO;
+            compilador.pila[compilador.pendientes].operacion = operacion;
+            compilador.pendientes++;
+            cursor++;
+            esperando_operando = true;
+        }
+    }
+
+    if (esperando_operando) {
+        return CALCULADORA_EXPRESION_INVALIDA; // Error: expresión vacía o terminada en un operador
+    }
+
+    while (compilador.pendientes > 0) {
+        struct pendiente_s * tope = &compilador.pila[--compilador.pendientes];
+        if ((tope->tipo == PENDIENTE_PARENTESIS) || !EmitirPendiente(&compilador, tope)) {
+            return CALCULADORA_EXPRESION_INVALIDA;
+        }
+    }
+    return CALCULADORA_CORRECTO;
+}
+
+static calculadora_estado_t EjecutarPrograma(const struct programa_s * programa, const int valores[],
+                                             int * resultado, medicion_hilo_t medicion) {
+    int pila[CALCULADORA_PILA_MAX];
+    int * tope = pila - 1;
+    calculadora_estado_t estado = EjecutarInstrucciones(programa, valores, &tope, medicion);
+
+    if (estado == CALCULADORA_CORRECTO) {
+        *resultado = pila[0];
+    }
+    return estado;
+}
+
+static calculadora_estado_t EjecutarInstrucciones(const struct programa_s * programa, const int valores[], int ** cima,
+                                                  medicion_hilo_t medicion) {
+    int * tope = *cima;
+    const struct instruccion_s * instruccion = programa->instrucciones;
+    const struct instruccion_s * fin = instruccion + programa->longitud;
+
+    for (; instruccion < fin; instruccion++) {
+#ifdef USAR_INSTRUMENTACION
+        if (medicion && (instruccion->codigo >= INSTRUCCION_SUMAR)) {
+            MedicionContar(&medicion->llamadas[instruccion->valor]);
+        }
+#endif
+        switch (instruccion->codigo) {
+        case INSTRUCCION_CONSTANTE:
+            *++tope = instruccion->valor;
+            break;
+        case INSTRUCCION_PARAMETRO:
+            *++tope = valores[instruccion->valor];
+            break;
+        case INSTRUCCION_NEGAR:
+            if (__builtin_sub_overflow(0, *tope, tope)) {
+                return CALCULADORA_DESBORDAMIENTO;
+            }
+            break;
+        case INSTRUCCION_SUMAR:
+            tope--;
+            if (__builtin_add_overflow(tope[0], tope[1], tope)) {
+                return FallarInstruccion(instruccion, medicion, CALCULADORA_DESBORDAMIENTO);
+            }
+            break;
+        case INSTRUCCION_RESTAR:
+            tope--;
+            if (__builtin_sub_overflow(tope[0], tope[1], tope)) {
+                return FallarInstruccion(instruccion, medicion, CALCULADORA_DESBORDAMIENTO);
+            }
+            break;
+        case INSTRUCCION_MULTIPLICAR:
+            tope--;
+            if (__builtin_mul_overflow(tope[0], tope[1], tope)) {
+                return FallarInstruccion(instruccion, medicion, CALCULADORA_DESBORDAMIENTO);
+            }
+            break;
+        case INSTRUCCION_DIVIDIR:
+            tope--;
+            if (tope[1] == 0) {
+                return FallarInstruccion(instruccion, medicion, CALCULADORA_DIVISION_POR_CERO);
+            }
+            if ((tope[0] == INT_MIN) && (tope[1] == -1)) {
+                return FallarInstruccion(instruccion, medicion, CALCULADORA_DESBORDAMIENTO);
+            }
+            *tope = tope[0] / tope[1];
+            break;
+        default:
+            tope--;
+            *tope = instruccion->funcion(tope[0], tope[1]);
+            break;
+        }
+    }
+
+    *cima = tope;
+    return CALCULADORA_CORRECTO;
+}
+
+static calculadora_estado_t FallarInstruccion(const struct instruccion_s * instruccion, medicion_hilo_t medicion,
+                                              calculadora_estado_t estado) {
+#ifdef USAR_INSTRUMENTACION
+    if (medicion && (instruccion->codigo >= INSTRUCCION_SUMAR)) {
+        MedicionContar(&medicion->errores[instruccion->valor]);
+    }
+#else
+    (void)instruccion;
+    (void)medicion;
+#endif
+    return estado;
+}
+
+static calculadora_estado_t RegistrarEstado(calculadora_t calculadora, calculadora_estado_t estado) {
+    if (estado != CALCULADORA_CORRECTO) {
+        atomic_fetch_add_explicit(&calculadora->errores[estado], 1, memory_order_relaxed);
+    }
+    return estado;
+}
+
+static void CalcularLote(void * contexto, size_t inicio, size_t fin) {
+    struct lote_s * lote = contexto;
+
+    for (size_t i = inicio; i < fin; i++) {
+        lote->resultados[i] = CalculadoraCalcula(lote->calculadora, lote->expresiones[i]);
+    }
+}
+
+static calculadora_estado_t CalcularTexto(calculadora_t calculadora, const char * expresion, size_t longitud,
+                                          int * resultado, medicion_hilo_t medicion) {
+    struct instruccion_s instrucciones[INSTRUCCIONES_LOCALES];
+    struct programa_s programa = {.instrucciones = instrucciones, .capacidad = INSTRUCCIONES_LOCALES};
+    struct evaluacion_s evaluacion; // Sin inicializar la pila, que se escribe antes de leerse
+    calculadora_estado_t estado;
+
+    evaluacion.tope = evaluacion.pila - 1;
+    evaluacion.medicion = medicion;
+    evaluacion.estado = CALCULADORA_CORRECTO;
+
+    estado = CompilarExpresion(calculadora, expresion, longitud, &programa, NULL, NULL, &evaluacion);
+    if ((estado == CALCULADORA_CORRECTO) && (programa.parametros > 0)) {
+        estado = CALCULADORA_EXPRESION_INVALIDA; // Error: la expresión usa parámetros sin valores
+    }
+    if (estado == CALCULADORA_CORRECTO) {
+        estado = evaluacion.estado;
+    }
+    if (estado == CALCULADORA_CORRECTO) {
+        estado = EjecutarInstrucciones(&programa, NULL, &evaluacion.tope, medicion);
+    }
+    if (estado == CALCULADORA_CORRECTO) {
+        *resultado = evaluacion.pila[0];
+    }
+    return estado;
+}
+
+static int ReducirSecuencial(operacion_t operacion, const int valores[], size_t cantidad) {
+    if (operacion->asociativa && operacion->conmutativa) {
+        if (operacion->codigo == INSTRUCCION_SUMAR) {
+            return VectorSumarTodos(valores, cantidad);
+        }
+        if (operacion->codigo == INSTRUCCION_MULTIPLICAR) {
+            return VectorMultiplicarTodos(valores, cantidad);
+        }
+    }
+
+    int resultado = valores[0];
+    for (size_t i = 1; i < cantidad; i++) {
+        resultado = operacion->funcion(resultado, valores[i]);
+    }
+    return resultado;
+}
+
+static void ReducirPorciones(void * contexto, size_t inicio, size_t fin) {
+    struct reduccion_s * reduccion = contexto;
+
+    for (size_t porcion = inicio; porcion < fin; porcion++) {
+        size_t primero = porcion * reduccion->bloque;
+        size_t cantidad = reduccion->cantidad - primero;
+        if (cantidad > reduccion->bloque) {
+            cantidad = reduccion->bloque;
+        }
+        reduccion->parciales[porcion] = ReducirSecuencial(reduccion->operacion, reduccion->valores + primero, cantidad);
     }
-    return NULL;
 }
 
 /* === Public function implementation ============================================================================== */
@@ -86,19 +898,92 @@ static operacion_t EncontrarOperacion(calculadora_t calculadora, char operador)
  */
 
 calculadora_t CalculadoraCrear(void) {
-    calculadora_t nueva_calculadora = malloc(sizeof(struct calculadora_s));
-    if (nueva_calculadora) {
-        nueva_calculadora->operaciones = NULL;
+#ifdef CALCULADORA_USAR_MEMORIA_ESTATICA
+    for (int i = 0; i < CALCULADORA_MAX; i++) {
+        if (!atomic_exchange(&ocupadas[i], true)) {
+            if (!arenas[i]) {
+                arenas[i] = ArenaCrear(memorias[i], sizeof(memorias[i]));
+            }
+            calculadora_t nueva_calculadora = CrearCalculadora(arenas[i]);
+            if (nueva_calculadora) {
+                nueva_calculadora->instancia = i;
+            } else {
+                ArenaReiniciar(arenas[i]);
+                atomic_store(&ocupadas[i], false);
+            }
+            return nueva_calculadora;
+        }
     }
+    return NULL;
+#else
+    return CrearCalculadora(NULL);
+#endif
+}
 
-    return nueva_calculadora;
+/**
+ * @brief Crea una nueva instancia de calculadora cuya memoria se asigna de una arena.
+ *
+ * @param arena Arena de la que se asigna la memoria.
+ * @return Un puntero a la nueva calculadora o NULL si la arena no tiene espacio suficiente.
+ */
+
+calculadora_t CalculadoraCrearEnArena(arena_t arena) {
+    if (!arena) {
+        return NULL;
+    }
+
+    return CrearCalculadora(arena);
+}
+
+/**
+ * @brief Libera la calculadora junto con todas sus operaciones.
+ *
+ * @param calculator Calculadora a destruir. Si es NULL no se hace nada.
+ */
+
+void CalculadoraDestruir(calculadora_t calculator) {
+    if (!calculator) {
+        return;
+    }
+
+    CacheFinalizar(calculator->cache);
+#ifdef USAR_INSTRUMENTACION
+    MedicionDestruir(calculator->medicion);
+#endif
+    pthread_mutex_destroy(&calculator->escritura);
+
+    if (calculator->arena) {
+#ifdef CALCULADORA_USAR_MEMORIA_ESTATICA
+        // La memoria estática se recupera completa antes de que otra calculadora pueda ocuparla
+        int instancia = calculator->instancia;
+        if (instancia >= 0) {
+            ArenaReiniciar(arenas[instancia]);
+            atomic_store(&ocupadas[instancia], false);
+        }
+#endif
+        return; // El resto de la memoria se recupera al reiniciar la arena
+    }
+
+    while (calculator->programas) {
+        programa_t siguiente = calculator->programas->siguiente;
+        Liberar(calculator, calculator->programas, 0);
+        calculator->programas = siguiente;
+    }
+    for (int operador = 0; operador < OPERADORES_CANTIDAD; operador++) {
+        Liberar(calculator, EncontrarOperacion(calculator->tabla, (char)operador), 0);
+    }
+    Liberar(calculator, calculator->tabla, 0);
+    Liberar(calculator, calculator->cache, 0);
+    Liberar(calculator, calculator, 0);
 }
 
 
 /**
  * @brief Agrega una nueva operación a la calculadora.
  *
- * No se permite registrar dos operaciones con el mismo símbolo.
+ * No se permite registrar dos operaciones con el mismo símbolo. La operación se registra asociativa a izquierda, con
+ * la precedencia multiplicativa si es OperacionMul u OperacionDiv y la aditiva en cualquier otro caso. OperacionAdd
+ * y OperacionMul se marcan además como asociativas y conmutativas.
  *
  * @param calculator Calculadora a la que se agregará la operación.
  * @param sumador Carácter que representa el operador (por ejemplo '+').
@@ -107,61 +992,510 @@ calculadora_t CalculadoraCrear(void) {
  */
 
 bool CalculadoraAddOperacion(calculadora_t calculator, char sumador, operacion_func_t funcion) {
-    if (!calculator || !funcion || EncontrarOperacion(calculator, sumador)) {
+    operacion_atributos_t atributos = {
+        .precedencia = PRECEDENCIA_ADITIVA,
+        .asociatividad = CALCULADORA_IZQUIERDA,
+    };
+
+    if ((funcion == OperacionMul) || (funcion == OperacionDiv)) {
+        atributos.precedencia = PRECEDENCIA_MULTIPLICATIVA;
+    }
+    if ((funcion == OperacionAdd) || (funcion == OperacionMul)) {
+        atributos.asociativa = true;
+        atributos.conmutativa = true;
+    }
+    return CalculadoraAddOperacionAtributos(calculator, sumador, funcion, &atributos);
+}
+
+/**
+ * @brief Agrega una nueva operación a la calculadora indicando su precedencia y asociatividad.
+ *
+ * Los paréntesis, los dígitos y los espacios están reservados para la sintaxis de las expresiones y no pueden
+ * registrarse como operadores. La operación se completa en una entrada nueva que luego se publica en la tabla, por
+ * lo que otros hilos pueden seguir evaluando expresiones mientras tanto.
+ *
+ * @param calculator Calculadora a la que se agregará la operación.
+ * @param operador Carácter que representa el operador.
+ * @param funcion Puntero a la función que implementa la operación.
+ * @param atributos Precedencia, asociatividad y propiedades algebraicas del operador.
+ * @return true si la operación se agregó correctamente, false si ya existía, el símbolo es reservado o hubo error.
+ */
+
+bool CalculadoraAddOperacionAtributos(calculadora_t calculator, char operador, operacion_func_t funcion,
+                                      const operacion_atributos_t * atributos) {
+    if (!calculator || !funcion || !atributos) {
+        return false;
+    }
+    if ((operador == '\0') || (operador == '(') || (operador == ')') || isdigit((unsigned char)operador) ||
+        isspace((unsigned char)operador)) {
         return false;
     }
 
-    operacion_t operacion = malloc(sizeof(struct operacion_s));
+    pthread_mutex_lock(&calculator->escritura);
+    tabla_t tabla = LeerTabla(calculator);
+    operacion_t operacion = NULL;
+    if (!EncontrarOperacion(tabla, operador)) {
+        operacion = Asignar(calculator, sizeof(struct operacion_s));
+    }
     if (operacion) {
-
-        operacion->operador = sumador;
+        operacion->simbolo = (unsigned char)operador;
+        operacion->precedencia = atributos->precedencia;
+        operacion->derecha = (atributos->asociatividad == CALCULADORA_DERECHA);
+        operacion->asociativa = atributos->asociativa;
+        operacion->conmutativa = atributos->conmutativa;
+        if (funcion == OperacionAdd) {
+            operacion->codigo = INSTRUCCION_SUMAR;
+        } else if (funcion == OperacionSub) {
+            operacion->codigo = INSTRUCCION_RESTAR;
+        } else if (funcion == OperacionMul) {
+            operacion->codigo = INSTRUCCION_MULTIPLICAR;
+        } else if (funcion == OperacionDiv) {
+            operacion->codigo = INSTRUCCION_DIVIDIR;
+        } else {
+            operacion->codigo = INSTRUCCION_LLAMAR;
+        }
         operacion->funcion = funcion;
-        operacion->siguiente = calculator->operaciones;
-        calculator->operaciones = operacion;
-        return true;
+
+        atomic_store_explicit(&tabla->operaciones[(unsigned char)operador], operacion, memory_order_release);
+        if (calculator->cache) {
+            CacheVaciar(calculator->cache); // Los resultados guardados pueden depender del conjunto de operaciones
+        }
     }
+    pthread_mutex_unlock(&calculator->escritura);
 
-    return false;
+    return operacion != NULL;
 }
 
 
 /**
- * @brief Evalúa una expresión en formato "a operador b".
- *
- * La función analiza la expresión, extrae los operandos y el operador, y ejecuta la operación correspondiente
- * registrada previamente en la calculadora.
+ * @brief Evalúa una expresión aritmética.
  *
  * @param calculator Calculadora con operaciones registradas.
- * @param expresion Cadena de texto con la expresión a evaluar (por ejemplo "3+5").
+ * @param expresion Cadena de texto con la expresión a evaluar (por ejemplo "3+5" o "2 + 3*(4-1)").
  * @return Resultado de la operación, o 0 si hay error o no se encuentra el operador.
  */
 
 int CalculadoraCalcula(calculadora_t calculator, const char * expresion) {
-    int a = 0, b = 0;
-    char operador = 0;
-    int resultado = 0;
+    if (!expresion) {
+        return 0; // Error: expresión nula
+    }
+
+    return CalculadoraCalculaTexto(calculator, expresion, strlen(expresion));
+}
+
+/**
+ * @brief Evalúa una expresión aritmética delimitada por su longitud.
+ *
+ * La expresión se compila sobre un programa en la pila de la función y luego se ejecuta; solo las expresiones muy
+ * largas necesitan memoria dinámica para sus instrucciones. Si la memoria de resultados está habilitada, las
+ * expresiones repetidas se responden desde ella sin compilarlas.
+ *
+ * @param calculator Calculadora con operaciones registradas.
+ * @param expresion Texto de la expresión a evaluar, no necesita terminar en '\0'.
+ * @param longitud Cantidad de caracteres de la expresión.
+ * @return Resultado de la operación, o 0 si hay error o no se encuentra el operador.
+ */
+
+int CalculadoraCalculaTexto(calculadora_t calculator, const char * expresion, size_t longitud) {
+    int resultado;
+
+    CalculadoraCalculaEstado(calculator, expresion, longitud, &resultado);
+    return resultado;
+}
+
+/**
+ * @brief Evalúa una expresión aritmética delimitada por su longitud e informa el estado de la evaluación.
+ *
+ * Solo los resultados correctos se guardan en la memoria de resultados, de modo que cada expresión errónea vuelve a
+ * evaluarse y a contarse como error.
+ *
+ * @param calculator Calculadora con operaciones registradas.
+ * @param expresion Texto de la expresión a evaluar, no necesita terminar en '\0'.
+ * @param longitud Cantidad de caracteres de la expresión.
+ * @param resultado Variable donde se guarda el resultado, o 0 si hay error. Puede ser NULL.
+ * @return CALCULADORA_CORRECTO si la expresión se evaluó, o el estado que describe el error.
+ */
+
+calculadora_estado_t CalculadoraCalculaEstado(calculadora_t calculator, const char * expresion, size_t longitud,
+                                              int * resultado) {
+    calculadora_estado_t estado = CALCULADORA_CORRECTO;
+    medicion_hilo_t medicion = NULL;
+    uint64_t generacion = 0;
+    int valor = 0;
 
     if (!calculator || !expresion) {
-        return 0; // Error: calculadora o expresión nula
+        estado = CALCULADORA_EXPRESION_INVALIDA; // Error: calculadora o expresión nula
+    } else {
+#ifdef USAR_INSTRUMENTACION
+        medicion = MedicionHilo(calculator->medicion);
+        uint64_t inicio = MedicionTiempo();
+#endif
+        if (!calculator->cache || !CacheBuscar(calculator->cache, expresion, longitud, &valor, &generacion)) {
+            estado = RegistrarEstado(calculator, CalcularTexto(calculator, expresion, longitud, &valor, medicion));
+            if ((estado == CALCULADORA_CORRECTO) && calculator->cache) {
+                CacheGuardar(calculator->cache, expresion, longitud, valor, generacion);
+            }
+        }
+#ifdef USAR_INSTRUMENTACION
+        if (medicion) {
+            MedicionLatencia(medicion, MedicionTiempo() - inicio);
+        }
+#endif
+    }
+
+    if (resultado) {
+        *resultado = (estado == CALCULADORA_CORRECTO) ? valor : 0;
+    }
+    return estado;
+}
+
+/**
+ * @brief Evalúa un lote de expresiones repartiéndolas entre varios hilos.
+ *
+ * Las expresiones se agrupan en bloques que los hilos se reparten con robo de trabajo, de modo que las expresiones
+ * de longitud despareja no dejan núcleos ociosos. Cada resultado es el mismo que devolvería CalculadoraCalcula.
+ *
+ * @param calculator Calculadora con operaciones registradas.
+ * @param expresiones Expresiones a evaluar.
+ * @param resultados Arreglo donde se guarda el resultado de cada expresión.
+ * @param n Cantidad de expresiones.
+ * @return true si se evaluó el lote, false si algún parámetro es inválido.
+ */
+
+bool CalculadoraCalculaLote(calculadora_t calculator, const char * expresiones[], int resultados[], size_t n) {
+    struct lote_s lote = {.calculadora = calculator, .expresiones = expresiones, .resultados = resultados};
+
+    if (!calculator || ((n > 0) && (!expresiones || !resultados))) {
+        return false;
+    }
+
+    ParaleloEjecutar(n, LOTE_BLOQUE, CalcularLote, &lote);
+    return true;
+}
+
+/**
+ * @brief Habilita, redimensiona o deshabilita la memoria de resultados de la calculadora.
+ *
+ * La memoria anterior, si existía, se descarta junto con sus estadísticas.
+ *
+ * @param calculator Calculadora a configurar.
+ * @param capacidad Cantidad máxima de expresiones a recordar, o 0 para deshabilitar la memoria.
+ * @return true si se aplicó la configuración, false si hubo un error.
+ */
+
+bool CalculadoraCacheHabilitar(calculadora_t calculator, size_t capacidad) {
+    if (!calculator) {
+        return false;
     }
 
-    for (int i = 0; i < strlen(expresion); i++) {
-        if ((expresion[i] < '0') || (expresion[i] > '9')) {
-        operador = expresion[i];
-        a = atoi(expresion);
-        b = atoi(expresion + i + 1);
-        break;
+    cache_t cache = NULL;
+    if (capacidad > 0) {
+        size_t tamano = CacheTamano(capacidad);
+        void * memoria = tamano ? Asignar(calculator, tamano) : NULL;
+        cache = CacheIniciar(memoria, capacidad);
+        if (!cache) {
+            Liberar(calculator, memoria, tamano);
+            return false;
         }
     }
 
-    operacion_t operacion = EncontrarOperacion(calculator, operador);
-    if (operacion) {
-        resultado = operacion->funcion(a, b);
+    CacheFinalizar(calculator->cache);
+    Liberar(calculator, calculator->cache, 0);
+    calculator->cache = cache;
+    return true;
+}
+
+/**
+ * @brief Informa los aciertos y fallos de la memoria de resultados desde que se habilitó.
+ *
+ * @param calculator Calculadora a consultar.
+ * @param aciertos Variable donde se guarda la cantidad de expresiones respondidas desde la memoria, puede ser NULL.
+ * @param fallos Variable donde se guarda la cantidad de expresiones que hubo que calcular, puede ser NULL.
+ * @return true si la memoria de resultados está habilitada, false en caso contrario.
+ */
+
+bool CalculadoraCacheEstadisticas(calculadora_t calculator, uint64_t * aciertos, uint64_t * fallos) {
+    if (!calculator || !calculator->cache) {
+        return false;
+    }
+
+    CacheEstadisticas(calculator->cache, aciertos, fallos);
+    return true;
+}
+
+/**
+ * @brief Aplica una operación registrada elemento a elemento sobre dos arreglos.
+ *
+ * Las operaciones incluidas en el módulo se resuelven con las implementaciones SIMD del módulo vector; el resto de
+ * las operaciones se aplican llamando a su función para cada elemento.
+ *
+ * @param calculator Calculadora con operaciones registradas.
+ * @param operador Carácter de la operación a aplicar.
+ * @param a Arreglo con los primeros operandos.
+ * @param b Arreglo con los segundos operandos.
+ * @param salida Arreglo donde se guardan los resultados.
+ * @param n Cantidad de elementos.
+ * @return true si se aplicó la operación, false si el operador no está registrado o algún parámetro es inválido.
+ */
+
+bool CalculadoraAplicarVector(calculadora_t calculator, char operador, const int a[], const int b[], int salida[],
+                              size_t n) {
+    if (!calculator || ((n > 0) && (!a || !b || !salida))) {
+        return false;
+    }
+
+    operacion_t operacion = EncontrarOperacion(LeerTabla(calculator), operador);
+    if (!operacion) {
+        return false;
+    }
+
+    if (operacion->codigo == INSTRUCCION_SUMAR) {
+        VectorSumar(a, b, salida, n);
+    } else if (operacion->codigo == INSTRUCCION_RESTAR) {
+        VectorRestar(a, b, salida, n);
+    } else if (operacion->codigo == INSTRUCCION_MULTIPLICAR) {
+        VectorMultiplicar(a, b, salida, n);
+    } else if (operacion->funcion == OperacionDiv) {
+        VectorDividir(a, b, salida, n);
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            salida[i] = operacion->funcion(a[i], b[i]);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reduce un arreglo a un único valor combinando sus elementos en orden con una operación registrada.
+ *
+ * Si la operación es asociativa, el arreglo se divide en porciones que los hilos reducen en paralelo y los
+ * resultados parciales se combinan de a pares, en orden, formando un árbol. En otro caso se pliega el arreglo de
+ * izquierda a derecha en el hilo que llama.
+ *
+ * @param calculator Calculadora con operaciones registradas.
+ * @param operador Carácter de la operación con la que se reduce.
+ * @param valores Arreglo a reducir.
+ * @param n Cantidad de elementos.
+ * @return Resultado de la reducción, o 0 si el arreglo está vacío, el operador no está registrado o hay un error.
+ */
+
+int CalculadoraReducir(calculadora_t calculator, char operador, const int valores[], size_t n) {
+    struct reduccion_s reduccion;
+
+    if (!calculator || !valores || (n == 0)) {
+        return 0;
+    }
+
+    operacion_t operacion = EncontrarOperacion(LeerTabla(calculator), operador);
+    if (!operacion) {
+        return 0;
+    }
+    if (!operacion->asociativa || (n <= REDUCCION_BLOQUE_MIN)) {
+        return ReducirSecuencial(operacion, valores, n);
+    }
+
+    reduccion.operacion = operacion;
+    reduccion.valores = valores;
+    reduccion.cantidad = n;
+    reduccion.bloque = (n + REDUCCION_PORCIONES - 1) / REDUCCION_PORCIONES;
+    if (reduccion.bloque < REDUCCION_BLOQUE_MIN) {
+        reduccion.bloque = REDUCCION_BLOQUE_MIN;
+    }
+    size_t porciones = (n + reduccion.bloque - 1) / reduccion.bloque;
+
+    ParaleloEjecutar(porciones, 1, ReducirPorciones, &reduccion);
+
+    for (size_t paso = 1; paso < porciones; paso *= 2) {
+        for (size_t i = 0; i + paso < porciones; i += 2 * paso) {
+            reduccion.parciales[i] = operacion->funcion(reduccion.parciales[i], reduccion.parciales[i + paso]);
+        }
+    }
+    return reduccion.parciales[0];
+}
+
+/**
+ * @brief Compila una expresión para poder evaluarla muchas veces sin volver a analizar el texto.
+ *
+ * @param calculator Calculadora con operaciones registradas.
+ * @param expresion Cadena de texto con la expresión a compilar (por ejemplo "a*3").
+ * @return Programa compilado, o NULL si la expresión es inválida o no se pudo asignar memoria.
+ */
+
+programa_t CalculadoraCompilar(calculadora_t calculator, const char * expresion) {
+    return CalculadoraCompilarNombres(calculator, expresion, NULL, NULL, NULL);
+}
+
+/**
+ * @brief Compila una expresión cuyos parámetros se escriben con nombres.
+ *
+ * Cada símbolo de la expresión genera a lo sumo una instrucción, por lo que el programa y sus instrucciones se
+ * asignan en un único bloque dimensionado por la longitud del texto. El programa queda registrado en la calculadora
+ * y se libera junto con ella en CalculadoraDestruir, o antes con CalculadoraLiberarPrograma.
+ *
+ * @param calculator Calculadora con operaciones registradas.
+ * @param expresion Cadena de texto con la expresión a compilar (por ejemplo "precio * cantidad").
+ * @param resolver Función que traduce cada nombre a un índice de parámetro, o NULL para usar las letras 'a' a 'z'.
+ * @param contexto Puntero que se pasa sin cambios al resolver.
+ * @param estado Variable donde se guarda el estado de la compilación, puede ser NULL.
+ * @return Programa compilado, o NULL si la expresión es inválida o no se pudo asignar memoria.
+ */
+
+programa_t CalculadoraCompilarNombres(calculadora_t calculator, const char * expresion, calculadora_resolver_t resolver,
+                                      void * contexto, calculadora_estado_t * estado) {
+    calculadora_estado_t resultado = CALCULADORA_EXPRESION_INVALIDA;
+    programa_t programa = NULL;
+    size_t longitud = expresion ? strlen(expresion) : 0;
+    size_t tamano = sizeof(struct programa_s) + longitud * sizeof(struct instruccion_s);
+
+    if (calculator && expresion && (longitud <= INT_MAX)) {
+        programa = Asignar(calculator, tamano);
     }
+    if (programa) {
+        programa->instrucciones = (struct instruccion_s *)(programa + 1);
+        programa->capacidad = (int)longitud;
+
+        resultado = CompilarExpresion(calculator, expresion, longitud, programa, resolver, contexto, NULL);
+        if (RegistrarEstado(calculator, resultado) == CALCULADORA_CORRECTO) {
+            pthread_mutex_lock(&calculator->escritura);
+            programa->anterior = NULL;
+            programa->siguiente = calculator->programas;
+            if (programa->siguiente) {
+                programa->siguiente->anterior = programa;
+            }
+            calculator->programas = programa;
+            pthread_mutex_unlock(&calculator->escritura);
+        } else {
+            Liberar(calculator, programa, tamano);
+            programa = NULL;
+        }
+    }
+
+    if (estado) {
+        *estado = resultado;
+    }
+    return programa;
+}
+
+/**
+ * @brief Libera un programa compilado antes de destruir la calculadora.
+ *
+ * Quita el programa de la lista doblemente enlazada de la calculadora en tiempo constante.
+ *
+ * @param calculator Calculadora que compiló el programa.
+ * @param programa Programa a liberar. Si es NULL no se hace nada.
+ */
 
+void CalculadoraLiberarPrograma(calculadora_t calculator, programa_t programa) {
+    if (!calculator || !programa) {
+        return;
+    }
+
+    pthread_mutex_lock(&calculator->escritura);
+    if (programa->anterior) {
+        programa->anterior->siguiente = programa->siguiente;
+    } else {
+        calculator->programas = programa->siguiente;
+    }
+    if (programa->siguiente) {
+        programa->siguiente->anterior = programa->anterior;
+    }
+    pthread_mutex_unlock(&calculator->escritura);
+
+    Liberar(calculator, programa, 0);
+}
+
+/**
+ * @brief Evalúa un programa compilado con los valores indicados para sus parámetros.
+ *
+ * @param calculator Calculadora que compiló el programa.
+ * @param programa Programa a evaluar.
+ * @param valores Valores de los parámetros, indexados desde 'a'. Puede ser NULL si el programa no tiene parámetros.
+ * @return Resultado de la operación, o 0 si hay error.
+ */
+
+int CalculadoraEvaluar(calculadora_t calculator, programa_t programa, const int valores[]) {
+    int resultado;
+
+    CalculadoraEvaluarEstado(calculator, programa, valores, &resultado);
     return resultado;
 }
 
+/**
+ * @brief Evalúa un programa compilado e informa el estado de la evaluación.
+ *
+ * @param calculator Calculadora que compiló el programa.
+ * @param programa Programa a evaluar.
+ * @param valores Valores de los parámetros, indexados desde 'a'. Puede ser NULL si el programa no tiene parámetros.
+ * @param resultado Variable donde se guarda el resultado, o 0 si hay error. Puede ser NULL.
+ * @return CALCULADORA_CORRECTO si el programa se evaluó, o el estado que describe el error.
+ */
+
+calculadora_estado_t CalculadoraEvaluarEstado(calculadora_t calculator, programa_t programa, const int valores[],
+                                              int * resultado) {
+    calculadora_estado_t estado = CALCULADORA_EXPRESION_INVALIDA;
+    medicion_hilo_t medicion = NULL;
+    int valor = 0;
+
+    if (calculator && programa && (valores || (programa->parametros == 0))) {
+#ifdef USAR_INSTRUMENTACION
+        medicion = MedicionHilo(calculator->medicion);
+#endif
+        estado = RegistrarEstado(calculator, EjecutarPrograma(programa, valores, &valor, medicion));
+    }
+
+    if (resultado) {
+        *resultado = (estado == CALCULADORA_CORRECTO) ? valor : 0;
+    }
+    return estado;
+}
+
+/**
+ * @brief Informa cuántos errores de cada tipo encontró la calculadora.
+ *
+ * Los contadores se incrementan sin ordenar con el resto de la memoria, por lo que la lectura hecha mientras otros
+ * hilos evalúan expresiones es aproximada.
+ *
+ * @param calculator Calculadora a consultar.
+ * @param errores Arreglo donde se guarda la cantidad de errores de cada estado.
+ * @return true si se leyeron los contadores, false si algún parámetro es inválido.
+ */
+
+bool CalculadoraErrores(calculadora_t calculator, uint64_t errores[CALCULADORA_ESTADOS]) {
+    if (!calculator || !errores) {
+        return false;
+    }
+
+    for (int estado = 0; estado < CALCULADORA_ESTADOS; estado++) {
+        errores[estado] = atomic_load_explicit(&calculator->errores[estado], memory_order_relaxed);
+    }
+    return true;
+}
+
+
+/**
+ * @brief Escribe en formato JSON las llamadas y errores de cada operador y el histograma de latencias de los cálculos.
+ *
+ * Suma los contadores de todos los hilos que usaron la calculadora en el momento de la lectura, sin detenerlos.
+ *
+ * @param calculator Calculadora a consultar.
+ * @param buffer Buffer donde se escribe el texto, terminado en '\0'.
+ * @param size Tamaño del buffer.
+ * @return Cantidad de caracteres escritos, o -1 si el buffer no alcanza o la instrumentación está deshabilitada.
+ */
+
+int CalculadoraSerializarMediciones(calculadora_t calculator, char buffer[], size_t size) {
+#ifdef USAR_INSTRUMENTACION
+    if (!calculator) {
+        return -1;
+    }
+    return MedicionSerializar(calculator->medicion, buffer, size);
+#else
+    (void)calculator;
+    (void)buffer;
+    (void)size;
+    return -1;
+#endif
+}
 
 /**
  * @brief Implementa la operación de suma.
@@ -203,16 +1537,19 @@ int OperacionMul(int a, int b) {
 /**
  * @brief Implementa la operación de división.
  *
- * Maneja el caso de división por cero imprimiendo un mensaje de error.
+ * No escribe mensajes: los errores se informan a través de CalculadoraCalculaEstado, que resuelve esta operación con
+ * sus propios controles.
  *
  * @param a Dividendo.
  * @param b Divisor.
- * @return Resultado de a / b. Si b es 0, se imprime un error y se retorna 0.
+ * @return Resultado de a / b. Si b es 0 se retorna 0, y si a es INT_MIN y b es -1 se retorna INT_MIN.
  */
 int OperacionDiv(int a, int b) {
     if (b == 0) {
-       printf ("error divison por cero/n");// Comportamiento indefinido si se intenta dividir por cero
-        return 0; // O se podría manejar de otra forma, como lanzar un error
+        return 0; // Error: división por cero
+    }
+    if (b == -1) {
+        return (int)(0u - (unsigned)a); // Evita la excepción del procesador al dividir INT_MIN por -1
     }
     return a / b;
 }
@@ -0,0 +1,182 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file conversion.c
+ ** @brief codigo fuente del módulo de conversión rápida entre enteros y texto decimal
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "conversion.h"
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define BYTES_REPETIDOS(byte) (0x0101010101010101ull * (byte)) //!< palabra de 64 bits con el byte en cada posición
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Cuenta cuántos de los ocho caracteres de una palabra, desde el primero, son dígitos decimales.
+ *
+ * @param digitos Palabra con ocho caracteres a los que ya se les restó '0' en cada byte.
+ * @return Cantidad de dígitos iniciales, entre 0 y 8.
+ */
+static unsigned ContarDigitos(uint64_t digitos);
+
+/**
+ * @brief Combina ocho dígitos de una palabra en su valor numérico con tres multiplicaciones.
+ *
+ * @param digitos Palabra con un dígito de 0 a 9 en cada byte, el primero en el byte menos significativo.
+ * @return Valor de los ocho dígitos.
+ */
+static uint32_t CombinarOchoDigitos(uint64_t digitos);
+
+/**
+ * @brief Cuenta las cifras decimales de un entero sin signo.
+ *
+ * @param valor Entero a analizar.
+ * @return Cantidad de cifras, entre 1 y 10.
+ */
+static size_t ContarCifras(uint32_t valor);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Representación decimal de los números del 00 al 99, para convertir de a dos dígitos
+static const char pares_digitos[] = "00010203040506070809"
+                                    "10111213141516171819"
+                                    "20212223242526272829"
+                                    "30313233343536373839"
+                                    "40414243444546474849"
+                                    "50515253545556575859"
+                                    "60616263646566676869"
+                                    "70717273747576777879"
+                                    "80818283848586878889"
+                                    "90919293949596979899";
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+unsigned ContarDigitos(uint64_t digitos) {
+    // Un byte no es dígito si quedó negativo al restar '0' o si supera 9; los acarreos entre bytes solo afectan a
+    // los bytes posteriores a un no dígito, que no se cuentan
+    uint64_t no_digitos = (digitos | (digitos + BYTES_REPETIDOS(0x76))) & BYTES_REPETIDOS(0x80);
+    return no_digitos ? (unsigned)__builtin_ctzll(no_digitos) / 8 : 8;
+}
+
+uint32_t CombinarOchoDigitos(uint64_t digitos) {
+    digitos = (digitos * 10) + (digitos >> 8);
+    digitos = (((digitos & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+               (((digitos >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+    return (uint32_t)digitos;
+}
+
+size_t ContarCifras(uint32_t valor) {
+    size_t cifras = 1;
+
+    while (valor >= 10000) {
+        valor /= 10000;
+        cifras += 4;
+    }
+    return cifras + (valor >= 10) + (valor >= 100) + (valor >= 1000);
+}
+
+/* === Public function implementation ============================================================================== */
+
+size_t ConversionEnteroATexto(int valor, char destino[]) {
+    if (valor < 0) {
+        destino[0] = '-';
+        return 1 + ConversionSinSignoATexto(0u - (uint32_t)valor, destino + 1);
+    }
+    return ConversionSinSignoATexto((uint32_t)valor, destino);
+}
+
+size_t ConversionSinSignoATexto(uint32_t valor, char destino[]) {
+    size_t longitud = ContarCifras(valor);
+    char * cursor = destino + longitud;
+
+    while (valor >= 100) {
+        uint32_t par = valor % 100;
+        valor /= 100;
+        cursor -= 2;
+        memcpy(cursor, &pares_digitos[par * 2], 2);
+    }
+    if (valor >= 10) {
+        memcpy(cursor - 2, &pares_digitos[valor * 2], 2);
+    } else {
+        cursor[-1] = (char)('0' + valor);
+    }
+    return longitud;
+}
+
+const char * ConversionTextoAEntero(const char * texto, const char * fin, int * valor) {
+    static const uint64_t potencias[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+    bool negativo = false;
+    uint64_t acumulado = 0;
+
+    if ((texto < fin) && ((*texto == '-') || (*texto == '+'))) {
+        negativo = (*texto == '-');
+        texto++;
+    }
+    const uint64_t limite = negativo ? (uint64_t)INT_MAX + 1 : INT_MAX;
+    const char * inicio = texto;
+
+    while (fin - texto >= 8) {
+        uint64_t palabra;
+        memcpy(&palabra, texto, sizeof(palabra));
+        palabra -= BYTES_REPETIDOS('0');
+
+        unsigned cantidad = ContarDigitos(palabra);
+        if (cantidad == 0) {
+            break;
+        }
+        acumulado = acumulado * potencias[cantidad] + CombinarOchoDigitos(palabra << (8 * (8 - cantidad)));
+        texto += cantidad;
+        if (acumulado > limite) {
+            return NULL;
+        }
+        if (cantidad < 8) {
+            break;
+        }
+    }
+
+    if (fin - texto < 8) {
+        while ((texto < fin) && ((unsigned char)(*texto - '0') < 10)) {
+            acumulado = acumulado * 10 + (unsigned)(*texto - '0');
+            texto++;
+            if (acumulado > limite) {
+                return NULL;
+            }
+        }
+    }
+
+    if (texto == inicio) {
+        return NULL;
+    }
+    *valor = negativo ? (int)(0u - (uint32_t)acumulado) : (int)acumulado;
+    return texto;
+}
+
+/* === End of documentation ======================================================================================== */
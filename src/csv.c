@@ -0,0 +1,437 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file csv.c
+ ** @brief codigo fuente del módulo de importación y exportación de alumnos en archivos CSV
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "csv.h"
+#include "conversion.h"
+#include "escritor.h"
+#include <errno.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define CAMPOS 3 //!< campos de cada fila: nombre, apellido y documento
+
+#define CABECERA "nombre,apellido,documento\n" //!< primera fila de los archivos que se escriben
+
+#define ESPECIALES ",\"\r\n" //!< caracteres que obligan a escribir un campo entre comillas
+
+//! Indica si un carácter es uno de los ESPECIALES, que terminan un campo sin comillas
+#define ES_ESPECIAL(caracter)                                                                                          \
+    (((caracter) == ',') || ((caracter) == '"') || ((caracter) == '\r') || ((caracter) == '\n'))
+
+//! Largo máximo de una fila válida: nombre y apellido entre comillas y con todos sus caracteres duplicados
+#define FILA_MAX (2 * (2 * ALUMNO_LARGO_MAX + 2) + CONVERSION_ENTERO_MAX + 5)
+
+#define LECTURA_TAMANO (1 << 20) //!< bytes que se leen de una vez cuando el archivo no se puede proyectar
+
+#define ESCRITURA_TAMANO (1 << 20) //!< bytes que se juntan antes de cada escritura en el archivo
+
+#define INCOMPLETO 0 //!< resultado de LeerFila cuando la fila sigue más allá de los caracteres disponibles
+
+#define INVALIDO -1 //!< resultado de LeerFila cuando la fila no tiene el formato esperado
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Campo de una fila, tal como está en el texto leído.
+ */
+
+struct campo_s {
+    const char * inicio; //!< primer carácter del valor, después de la comilla de apertura si la tiene
+    size_t largo;        //!< caracteres del valor en el texto, sin las comillas de apertura y cierre
+    size_t comillas;     //!< comillas duplicadas dentro del valor, que al copiarlo quedan simples
+};
+
+/**
+ * @brief Estado de una importación.
+ */
+
+struct importacion_s {
+    alumno_t * alumnos; //!< arreglo donde se guardan los alumnos creados
+    size_t capacidad;   //!< cantidad de referencias que entran en el arreglo
+    size_t cantidad;    //!< cantidad de alumnos creados
+    bool revisada;      //!< indica que ya se vio la primera fila, que puede ser la cabecera
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Reconoce los campos de una fila sin copiarlos.
+ *
+ * @param texto Caracteres disponibles, a partir del comienzo de la fila.
+ * @param disponibles Cantidad de caracteres disponibles.
+ * @param final Indica que después de los caracteres disponibles termina el archivo.
+ * @param campos Arreglo donde se guardan los CAMPOS de la fila.
+ * @return Cantidad de caracteres de la fila, incluido el salto de línea, INCOMPLETO si hacen falta más caracteres o
+ *         INVALIDO si la fila no tiene el formato esperado.
+ */
+static int LeerFila(const char texto[], size_t disponibles, bool final, struct campo_s campos[]);
+
+/**
+ * @brief Compara un campo con un texto fijo.
+ *
+ * @param campo Campo a comparar.
+ * @param texto Texto terminado en '\0'.
+ * @return true si el valor del campo es igual al texto.
+ */
+static bool Igual(const struct campo_s * campo, const char texto[]);
+
+/**
+ * @brief Copia el valor de un campo de texto, convirtiendo las comillas duplicadas en simples.
+ *
+ * @param campo Campo a copiar.
+ * @param destino Donde se guarda el valor terminado en '\0', con lugar para ALUMNO_LARGO_MAX + 1 caracteres.
+ * @return true si se copió, false si el valor es demasiado largo o contiene un '\0'.
+ */
+static bool CopiarTexto(const struct campo_s * campo, char destino[]);
+
+/**
+ * @brief Convierte el valor de un campo en un número de documento.
+ *
+ * @param campo Campo a convertir.
+ * @param documento Variable donde se guarda el número.
+ * @return true si el valor tiene solo cifras y entra en 32 bits.
+ */
+static bool ConvertirDocumento(const struct campo_s * campo, uint32_t * documento);
+
+/**
+ * @brief Crea el alumno de una fila, salvo que sea la cabecera.
+ *
+ * @param importacion Estado de la importación.
+ * @param campos Campos de la fila.
+ * @return true si se creó el alumno o se salteó la cabecera, false si la fila no es válida, no hay lugar en el
+ *         arreglo o no se pudo crear el alumno.
+ */
+static bool AgregarFila(struct importacion_s * importacion, const struct campo_s campos[]);
+
+/**
+ * @brief Crea los alumnos de todas las filas completas de un tramo de texto.
+ *
+ * @param importacion Estado de la importación.
+ * @param texto Caracteres disponibles, a partir del comienzo de una fila.
+ * @param disponibles Cantidad de caracteres disponibles.
+ * @param final Indica que después de los caracteres disponibles termina el archivo.
+ * @param consumidos Variable donde se guarda la cantidad de caracteres de las filas procesadas.
+ * @return true si todas las filas completas son válidas, false en otro caso.
+ */
+static bool Procesar(struct importacion_s * importacion, const char texto[], size_t disponibles, bool final,
+                     size_t * consumidos);
+
+/**
+ * @brief Lee el archivo de a tramos grandes y crea los alumnos de cada tramo.
+ *
+ * @param importacion Estado de la importación.
+ * @param descriptor Descriptor del que se lee.
+ * @return true si se leyó el archivo completo y todas sus filas son válidas.
+ */
+static bool LeerTramos(struct importacion_s * importacion, int descriptor);
+
+/**
+ * @brief Escribe un campo de texto, entre comillas si contiene alguno de los caracteres ESPECIALES.
+ *
+ * @param destino Donde se escribe el campo, con lugar para el doble de caracteres del texto más dos.
+ * @param texto Texto terminado en '\0'.
+ * @return Posición siguiente al último carácter escrito.
+ */
+static char * EscribirCampo(char destino[], const char texto[]);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+int LeerFila(const char texto[], size_t disponibles, bool final, struct campo_s campos[]) {
+    size_t posicion = 0;
+
+    for (size_t campo = 0; campo < CAMPOS; campo++) {
+        struct campo_s * actual = &campos[campo];
+
+        actual->comillas = 0;
+        if ((posicion < disponibles) && (texto[posicion] == '"')) {
+            actual->inicio = texto + posicion + 1;
+            do {
+                const char * comilla = memchr(texto + posicion + 1, '"', disponibles - posicion - 1);
+                if (comilla == NULL) {
+                    return final ? INVALIDO : INCOMPLETO;
+                }
+                posicion = (size_t)(comilla - texto) + 1;
+                if ((posicion == disponibles) && !final) {
+                    return INCOMPLETO;
+                }
+                // Dos comillas seguidas son una comilla dentro del valor y no su cierre
+                actual->comillas += (posicion < disponibles) && (texto[posicion] == '"');
+            } while ((posicion < disponibles) && (texto[posicion] == '"'));
+            actual->largo = (size_t)(texto + posicion - 1 - actual->inicio);
+        } else {
+            actual->inicio = texto + posicion;
+            while ((posicion < disponibles) && !ES_ESPECIAL(texto[posicion])) {
+                posicion++;
+            }
+            actual->largo = (size_t)(texto + posicion - actual->inicio);
+        }
+
+        // Cada campo termina en una coma, salvo el último que termina la fila
+        if (posicion == disponibles) {
+            if (!final) {
+                return INCOMPLETO;
+            }
+            return (campo == CAMPOS - 1) ? (int)posicion : INVALIDO;
+        }
+        char separador = texto[posicion++];
+        if (campo < CAMPOS - 1) {
+            if (separador != ',') {
+                return INVALIDO;
+            }
+        } else if (separador == '\n') {
+            return (int)posicion;
+        } else if ((separador == '\r') && (posicion < disponibles)) {
+            return (texto[posicion] == '\n') ? (int)posicion + 1 : INVALIDO;
+        } else if (separador == '\r') {
+            return final ? (int)posicion : INCOMPLETO;
+        } else {
+            return INVALIDO;
+        }
+    }
+    return INVALIDO;
+}
+
+bool Igual(const struct campo_s * campo, const char texto[]) {
+    return (campo->comillas == 0) && (campo->largo == strlen(texto)) &&
+           (memcmp(campo->inicio, texto, campo->largo) == 0);
+}
+
+bool CopiarTexto(const struct campo_s * campo, char destino[]) {
+    size_t largo = campo->largo - campo->comillas;
+
+    if (largo > ALUMNO_LARGO_MAX) {
+        return false;
+    }
+    if (campo->comillas == 0) {
+        memcpy(destino, campo->inicio, largo);
+    } else {
+        for (size_t i = 0, j = 0; j < largo; i++, j++) {
+            destino[j] = campo->inicio[i];
+            i += (campo->inicio[i] == '"');
+        }
+    }
+    destino[largo] = '\0';
+    return memchr(destino, '\0', largo) == NULL;
+}
+
+bool ConvertirDocumento(const struct campo_s * campo, uint32_t * documento) {
+    uint64_t valor = 0;
+
+    if ((campo->largo == 0) || (campo->largo > CONVERSION_ENTERO_MAX - 1)) {
+        return false;
+    }
+    for (size_t i = 0; i < campo->largo; i++) {
+        if ((campo->inicio[i] < '0') || (campo->inicio[i] > '9')) {
+            return false;
+        }
+        valor = valor * 10 + (uint64_t)(campo->inicio[i] - '0');
+    }
+    *documento = (uint32_t)valor;
+    return valor <= UINT32_MAX;
+}
+
+bool AgregarFila(struct importacion_s * importacion, const struct campo_s campos[]) {
+    char nombre[ALUMNO_LARGO_MAX + 1];
+    char apellido[ALUMNO_LARGO_MAX + 1];
+    uint32_t documento;
+
+    if (!importacion->revisada) {
+        importacion->revisada = true;
+        if (Igual(&campos[0], "nombre") && Igual(&campos[1], "apellido") && Igual(&campos[2], "documento")) {
+            return true;
+        }
+    }
+    if ((importacion->cantidad == importacion->capacidad) || !CopiarTexto(&campos[0], nombre) ||
+        !CopiarTexto(&campos[1], apellido) || !ConvertirDocumento(&campos[2], &documento)) {
+        return false;
+    }
+
+    alumno_t alumno = AlumnoCrear(nombre, apellido, documento);
+    if (alumno == NULL) {
+        return false;
+    }
+    importacion->alumnos[importacion->cantidad++] = alumno;
+    return true;
+}
+
+bool Procesar(struct importacion_s * importacion, const char texto[], size_t disponibles, bool final,
+              size_t * consumidos) {
+    size_t posicion = 0;
+
+    while (posicion < disponibles) {
+        size_t resto = disponibles - posicion;
+        struct campo_s campos[CAMPOS];
+
+        // Las líneas vacías se saltean
+        if (texto[posicion] == '\n') {
+            posicion++;
+            continue;
+        }
+        if ((texto[posicion] == '\r') && (resto == 1) && !final) {
+            break;
+        }
+        if ((texto[posicion] == '\r') && (resto > 1) && (texto[posicion + 1] == '\n')) {
+            posicion += 2;
+            continue;
+        }
+
+        // Una fila válida nunca supera FILA_MAX, así que no hace falta mirar más allá
+        size_t tramo = (resto < FILA_MAX) ? resto : FILA_MAX;
+        int leidos = LeerFila(texto + posicion, tramo, final && (tramo == resto), campos);
+        if ((leidos == INCOMPLETO) && (tramo == resto)) {
+            break;
+        }
+        if ((leidos <= 0) || !AgregarFila(importacion, campos)) {
+            return false;
+        }
+        posicion += (size_t)leidos;
+    }
+    *consumidos = posicion;
+    return true;
+}
+
+bool LeerTramos(struct importacion_s * importacion, int descriptor) {
+    char * buffer = malloc(LECTURA_TAMANO);
+    size_t inicio = 0;
+    size_t fin = 0;
+    bool terminada = false;
+    bool correcto = (buffer != NULL);
+
+    while (correcto && !terminada) {
+        // Lo que quedó de una fila incompleta pasa al comienzo y el resto del buffer se completa con datos nuevos
+        memmove(buffer, buffer + inicio, fin - inicio);
+        fin = fin - inicio;
+        inicio = 0;
+
+        ssize_t leidos = read(descriptor, buffer + fin, LECTURA_TAMANO - fin);
+        if (leidos < 0) {
+            correcto = (errno == EINTR);
+            continue;
+        }
+        terminada = (leidos == 0);
+        fin = fin + (size_t)leidos;
+
+        size_t consumidos;
+        correcto = Procesar(importacion, buffer + inicio, fin - inicio, terminada, &consumidos);
+        inicio = inicio + consumidos;
+    }
+    free(buffer);
+    return correcto && (inicio == fin);
+}
+
+char * EscribirCampo(char destino[], const char texto[]) {
+    size_t largo = strlen(texto);
+
+    if (strcspn(texto, ESPECIALES) == largo) {
+        memcpy(destino, texto, largo);
+        return destino + largo;
+    }
+    *destino++ = '"';
+    for (size_t i = 0; i < largo; i++) {
+        if (texto[i] == '"') {
+            *destino++ = '"';
+        }
+        *destino++ = texto[i];
+    }
+    *destino++ = '"';
+    return destino;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int CsvEscribir(alumno_t alumnos[], size_t cantidad, int descriptor) {
+    escritor_t escritor = EscritorCrear(ESCRITURA_TAMANO + FILA_MAX);
+    bool correcto = (escritor != NULL) && EscritorAgregar(escritor, CABECERA, sizeof(CABECERA) - 1);
+
+    for (size_t i = 0; correcto && (i < cantidad); i++) {
+        // El buffer tiene lugar para una fila de largo máximo después de ESCRITURA_TAMANO, así que nunca se agranda
+        char * fila = (alumnos[i] != NULL) ? EscritorReservar(escritor, FILA_MAX) : NULL;
+        if (fila == NULL) {
+            correcto = false;
+            break;
+        }
+
+        char * fin = EscribirCampo(fila, AlumnoNombre(alumnos[i]));
+        *fin++ = ',';
+        fin = EscribirCampo(fin, AlumnoApellido(alumnos[i]));
+        *fin++ = ',';
+        fin += ConversionSinSignoATexto(AlumnoDocumento(alumnos[i]), fin);
+        *fin++ = '\n';
+        EscritorAvanzar(escritor, (size_t)(fin - fila));
+
+        if (EscritorLargo(escritor) >= ESCRITURA_TAMANO) {
+            correcto = (EscritorVolcar(escritor, descriptor) == 0);
+        }
+    }
+    correcto = correcto && (EscritorVolcar(escritor, descriptor) == 0);
+    EscritorDestruir(escritor);
+    return correcto ? 0 : -1;
+}
+
+int CsvLeer(int descriptor, alumno_t alumnos[], size_t capacidad) {
+    struct importacion_s importacion = {.alumnos = alumnos, .capacidad = (capacidad < INT_MAX) ? capacidad : INT_MAX};
+    void * proyeccion = MAP_FAILED;
+    struct stat estado;
+    size_t tamano = 0;
+    bool correcto;
+
+    if ((fstat(descriptor, &estado) == 0) && S_ISREG(estado.st_mode) && (estado.st_size > 0) &&
+        ((uint64_t)estado.st_size <= SIZE_MAX)) {
+        tamano = (size_t)estado.st_size;
+        proyeccion = mmap(NULL, tamano, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    }
+
+    if (proyeccion != MAP_FAILED) {
+        size_t consumidos;
+        madvise(proyeccion, tamano, MADV_SEQUENTIAL);
+        correcto = Procesar(&importacion, proyeccion, tamano, true, &consumidos) && (consumidos == tamano);
+        munmap(proyeccion, tamano);
+    } else {
+        correcto = LeerTramos(&importacion, descriptor);
+    }
+
+    if (!correcto) {
+        while (importacion.cantidad > 0) {
+            AlumnoDestruir(alumnos[--importacion.cantidad]);
+        }
+        return -1;
+    }
+    return (int)importacion.cantidad;
+}
+
+/* === End of documentation ======================================================================================== */
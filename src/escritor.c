@@ -0,0 +1,158 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file escritor.c
+ ** @brief codigo fuente del módulo de buffers de salida que crecen a medida que se escribe en ellos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "escritor.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define CAPACIDAD_MINIMA 256 //!< bytes que se reservan la primera vez que se agranda un escritor sin capacidad
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Datos de un escritor.
+ */
+
+struct escritor_s {
+    char * datos;     //!< buffer con los caracteres escritos
+    size_t largo;     //!< cantidad de caracteres escritos
+    size_t capacidad; //!< bytes reservados en el buffer
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Agranda el buffer para que entren al menos la cantidad de bytes indicada.
+ *
+ * @param escritor Escritor a agrandar.
+ * @param necesarios Cantidad total de bytes que debe poder guardar el buffer.
+ * @return true si el buffer tiene lugar suficiente, false si no hay memoria.
+ */
+static bool Agrandar(escritor_t escritor, size_t necesarios);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+bool Agrandar(escritor_t escritor, size_t necesarios) {
+    size_t capacidad = (escritor->capacidad == 0) ? CAPACIDAD_MINIMA : escritor->capacidad;
+
+    while (capacidad < necesarios) {
+        capacidad = (capacidad > SIZE_MAX / 2) ? necesarios : 2 * capacidad;
+    }
+
+    char * datos = realloc(escritor->datos, capacidad);
+    if (datos == NULL) {
+        return false;
+    }
+    escritor->datos = datos;
+    escritor->capacidad = capacidad;
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+escritor_t EscritorCrear(size_t capacidad) {
+    escritor_t escritor = calloc(1, sizeof(struct escritor_s));
+
+    if ((escritor != NULL) && (capacidad > 0) && !Agrandar(escritor, capacidad + 1)) {
+        free(escritor);
+        escritor = NULL;
+    }
+    return escritor;
+}
+
+void EscritorDestruir(escritor_t escritor) {
+    if (escritor) {
+        free(escritor->datos);
+        free(escritor);
+    }
+}
+
+char * EscritorReservar(escritor_t escritor, size_t cantidad) {
+    if (cantidad >= SIZE_MAX - escritor->largo) {
+        return NULL;
+    }
+
+    size_t necesarios = escritor->largo + cantidad + 1;
+    if ((necesarios > escritor->capacidad) && !Agrandar(escritor, necesarios)) {
+        return NULL;
+    }
+    return escritor->datos + escritor->largo;
+}
+
+void EscritorAvanzar(escritor_t escritor, size_t cantidad) {
+    escritor->largo += cantidad;
+}
+
+bool EscritorAgregar(escritor_t escritor, const char datos[], size_t cantidad) {
+    char * destino = EscritorReservar(escritor, cantidad);
+
+    if (destino == NULL) {
+        return false;
+    }
+    memcpy(destino, datos, cantidad);
+    escritor->largo += cantidad;
+    return true;
+}
+
+const char * EscritorDatos(escritor_t escritor) {
+    return escritor->datos;
+}
+
+size_t EscritorLargo(escritor_t escritor) {
+    return escritor->largo;
+}
+
+void EscritorVaciar(escritor_t escritor) {
+    escritor->largo = 0;
+}
+
+int EscritorVolcar(escritor_t escritor, int descriptor) {
+    size_t escritos = 0;
+
+    while (escritos < escritor->largo) {
+        ssize_t resultado = write(descriptor, escritor->datos + escritos, escritor->largo - escritos);
+        if (resultado <= 0) {
+            if ((resultado < 0) && (errno == EINTR)) {
+                continue;
+            }
+            return -1;
+        }
+        escritos += (size_t)resultado;
+    }
+    escritor->largo = 0;
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,226 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file flujo.c
+ ** @brief codigo fuente del módulo para evaluar flujos de expresiones separadas por líneas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "flujo.h"
+#include "conversion.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Buffer de salida donde se acumulan los resultados.
+ */
+
+typedef struct salida_s {
+    int descriptor; //!< descriptor de archivo de la salida
+    size_t usados;  //!< bytes ocupados del buffer
+    bool error;     //!< indica si falló alguna escritura
+    char * buffer;  //!< buffer de FLUJO_ESCRITURA bytes
+} * salida_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Escribe todo el contenido del buffer de salida en su descriptor.
+ *
+ * @param salida Buffer de salida.
+ * @return true si se escribió todo, false si hubo un error de escritura.
+ */
+static bool VaciarSalida(salida_t salida);
+
+/**
+ * @brief Evalúa las líneas completas de un bloque de texto y agrega sus resultados al buffer de salida.
+ *
+ * @param calculadora Calculadora con las operaciones registradas.
+ * @param texto Bloque de texto con las expresiones.
+ * @param longitud Cantidad de bytes del bloque.
+ * @param final true si el bloque termina la entrada, en cuyo caso la última línea se evalúa aunque no termine en "\n".
+ * @param salida Buffer de salida.
+ * @return Cantidad de bytes procesados; los restantes forman una línea incompleta.
+ */
+static size_t EvaluarLineas(calculadora_t calculadora, const char * texto, size_t longitud, bool final,
+                            salida_t salida);
+
+/**
+ * @brief Evalúa una entrada que es un archivo regular mapeándolo completo en memoria.
+ *
+ * @param calculadora Calculadora con las operaciones registradas.
+ * @param entrada Descriptor del archivo.
+ * @param tamano Tamaño del archivo en bytes.
+ * @param salida Buffer de salida.
+ * @return true si se procesó todo el archivo, false si no se pudo mapear.
+ */
+static bool EvaluarMapeado(calculadora_t calculadora, int entrada, size_t tamano, salida_t salida);
+
+/**
+ * @brief Evalúa una entrada leyéndola en bloques de FLUJO_LECTURA bytes.
+ *
+ * @param calculadora Calculadora con las operaciones registradas.
+ * @param entrada Descriptor de la entrada.
+ * @param salida Buffer de salida.
+ * @return true si se procesó toda la entrada, false si hubo un error de lectura o de memoria.
+ */
+static bool EvaluarLeyendo(calculadora_t calculadora, int entrada, salida_t salida);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+bool VaciarSalida(salida_t salida) {
+    size_t escritos = 0;
+
+    while (!salida->error && (escritos < salida->usados)) {
+        ssize_t resultado = write(salida->descriptor, salida->buffer + escritos, salida->usados - escritos);
+        if (resultado > 0) {
+            escritos += (size_t)resultado;
+        } else if ((resultado == 0) || (errno != EINTR)) {
+            // Una escritura que no avanza no va a avanzar al repetirla
+            salida->error = true;
+        }
+    }
+    salida->usados = 0;
+    return !salida->error;
+}
+
+size_t EvaluarLineas(calculadora_t calculadora, const char * texto, size_t longitud, bool final, salida_t salida) {
+    size_t procesados = 0;
+
+    while (procesados < longitud) {
+        const char * inicio = texto + procesados;
+        const char * fin_linea = memchr(inicio, '\n', longitud - procesados);
+        size_t siguiente;
+
+        if (fin_linea) {
+            siguiente = (size_t)(fin_linea - texto) + 1;
+        } else if (final) {
+            fin_linea = texto + longitud;
+            siguiente = longitud;
+        } else {
+            break;
+        }
+        if ((fin_linea > inicio) && (fin_linea[-1] == '\r')) {
+            fin_linea--;
+        }
+
+        if (salida->usados + CONVERSION_ENTERO_MAX + 1 > FLUJO_ESCRITURA) {
+            VaciarSalida(salida);
+        }
+        int resultado;
+        if (CalculadoraCalculaEstado(calculadora, inicio, (size_t)(fin_linea - inicio), &resultado) ==
+            CALCULADORA_CORRECTO) {
+            salida->usados += ConversionEnteroATexto(resultado, salida->buffer + salida->usados);
+        } else {
+            memcpy(salida->buffer + salida->usados, FLUJO_ERROR, sizeof(FLUJO_ERROR) - 1);
+            salida->usados += sizeof(FLUJO_ERROR) - 1;
+        }
+        salida->buffer[salida->usados++] = '\n';
+        procesados = siguiente;
+    }
+    return procesados;
+}
+
+bool EvaluarMapeado(calculadora_t calculadora, int entrada, size_t tamano, salida_t salida) {
+    void * datos = mmap(NULL, tamano, PROT_READ, MAP_PRIVATE, entrada, 0);
+    if (datos == MAP_FAILED) {
+        return false;
+    }
+
+    madvise(datos, tamano, MADV_SEQUENTIAL);
+    EvaluarLineas(calculadora, datos, tamano, true, salida);
+    munmap(datos, tamano);
+    return true;
+}
+
+bool EvaluarLeyendo(calculadora_t calculadora, int entrada, salida_t salida) {
+    size_t capacidad = FLUJO_LECTURA;
+    size_t pendientes = 0;
+    char * buffer = malloc(capacidad);
+    bool resultado = (buffer != NULL);
+
+    while (resultado) {
+        if (pendientes == capacidad) {
+            // Una sola línea ocupa todo el buffer: se agranda para poder leerla completa
+            char * mayor = realloc(buffer, capacidad * 2);
+            if (!mayor) {
+                resultado = false;
+                break;
+            }
+            buffer = mayor;
+            capacidad *= 2;
+        }
+
+        ssize_t leidos = read(entrada, buffer + pendientes, capacidad - pendientes);
+        if (leidos < 0) {
+            resultado = (errno == EINTR);
+            continue;
+        }
+
+        pendientes += (size_t)leidos;
+        size_t procesados = EvaluarLineas(calculadora, buffer, pendientes, leidos == 0, salida);
+        pendientes -= procesados;
+        memmove(buffer, buffer + procesados, pendientes);
+        if (leidos == 0) {
+            break;
+        }
+    }
+
+    free(buffer);
+    return resultado;
+}
+
+/* === Public function implementation ============================================================================== */
+
+bool FlujoEvaluar(calculadora_t calculadora, int entrada, int salida) {
+    struct salida_s escritura = {.descriptor = salida, .buffer = malloc(FLUJO_ESCRITURA)};
+    struct stat estado;
+    bool resultado = false;
+
+    if (!calculadora || !escritura.buffer) {
+        free(escritura.buffer);
+        return false;
+    }
+
+    if ((fstat(entrada, &estado) == 0) && S_ISREG(estado.st_mode) && (estado.st_size > 0)) {
+        resultado = EvaluarMapeado(calculadora, entrada, (size_t)estado.st_size, &escritura);
+    }
+    if (!resultado) {
+        resultado = EvaluarLeyendo(calculadora, entrada, &escritura);
+    }
+
+    resultado = VaciarSalida(&escritura) && resultado;
+    free(escritura.buffer);
+    return resultado;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,653 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file hoja.c
+ ** @brief codigo fuente del módulo de hojas de cálculo con variables con nombre y recálculo incremental
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "hoja.h"
+#include <ctype.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SIN_CELDA SIZE_MAX //!< marca de lugar libre en el índice de nombres y de celda inexistente
+
+#define CELDAS_INICIALES 16 //!< cantidad de celdas para las que se reserva memoria al crear la hoja
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Arreglo de posiciones de celdas que crece a medida que se le agregan elementos.
+ */
+
+struct lista_s {
+    size_t * elementos; //!< posiciones guardadas
+    size_t cantidad;    //!< cantidad de posiciones guardadas
+    size_t capacidad;   //!< cantidad de posiciones que entran sin volver a asignar memoria
+};
+
+/**
+ * @brief Celda de la hoja.
+ *
+ * Las celdas se refieren entre sí por su posición en el arreglo de celdas de la hoja, que no cambia aunque el
+ * arreglo se vuelva a asignar al crecer.
+ */
+
+struct celda_s {
+    char * nombre;                  //!< nombre de la celda, terminado en '\0'
+    size_t longitud;                //!< cantidad de caracteres del nombre
+    uint64_t hash;                  //!< dispersión del nombre
+    int valor;                      //!< último valor de la celda
+    calculadora_estado_t estado;    //!< estado de la última evaluación de la fórmula
+    programa_t programa;            //!< fórmula compilada, o NULL si la celda es una entrada
+    struct lista_s dependencias;    //!< celdas que lee la fórmula, en el orden de sus parámetros
+    struct lista_s dependientes;    //!< celdas cuyas fórmulas leen esta celda
+    bool desactualizada;            //!< la fórmula debe volver a evaluarse antes de usar el valor
+    uint32_t marca;                 //!< último recorrido del grafo que visitó la celda
+    size_t revisadas;               //!< dependencias ya revisadas mientras la celda está en la pila de Actualizar
+};
+
+/**
+ * @brief Hoja de cálculo.
+ *
+ * Los nombres se ubican con un índice de direccionamiento abierto con sondeo lineal, con al menos el doble de
+ * lugares que celdas. Se mantiene la propiedad de que las celdas que dependen de una celda desactualizada también
+ * están desactualizadas, por lo que al propagar un cambio el recorrido se detiene en la primera celda que ya lo
+ * estaba.
+ */
+
+struct hoja_s {
+    calculadora_t calculadora;  //!< calculadora con la que se compilan y evalúan las fórmulas
+    struct celda_s * celdas;    //!< arreglo de celdas
+    size_t cantidad;            //!< cantidad de celdas
+    size_t capacidad;           //!< cantidad de celdas que entran en el arreglo
+    size_t * indice;            //!< posición de la celda guardada en cada lugar, o SIN_CELDA
+    size_t mascara;             //!< cantidad de lugares del índice menos uno
+    struct lista_s pila;        //!< pila de los recorridos del grafo, con lugar para todas las celdas
+    struct lista_s nuevas;      //!< dependencias de la fórmula que se está compilando
+    int * valores;              //!< valores de los parámetros de la fórmula que se evalúa
+    size_t capacidad_valores;   //!< cantidad de valores que entran en el arreglo
+    uint32_t marca;             //!< número del último recorrido del grafo
+    uint64_t evaluaciones;      //!< cantidad de fórmulas evaluadas
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula la dispersión de un nombre.
+ *
+ * @param nombre Caracteres del nombre.
+ * @param longitud Cantidad de caracteres del nombre.
+ * @return Dispersión de 64 bits del nombre.
+ */
+static uint64_t Dispersar(const char * nombre, size_t longitud);
+
+/**
+ * @brief Indica si un texto es un nombre de celda válido.
+ *
+ * @param nombre Caracteres del nombre.
+ * @param longitud Cantidad de caracteres del nombre.
+ * @return true si empieza con una letra o '_' y sigue con letras, dígitos o '_'.
+ */
+static bool NombreValido(const char * nombre, size_t longitud);
+
+/**
+ * @brief Asegura que una lista tenga lugar para una cantidad de posiciones.
+ *
+ * @param lista Lista a agrandar.
+ * @param capacidad Cantidad de posiciones que debe poder guardar.
+ * @return true si la lista tiene lugar suficiente, false si no se pudo asignar memoria.
+ */
+static bool Reservar(struct lista_s * lista, size_t capacidad);
+
+/**
+ * @brief Quita la primera aparición de una posición de una lista, sin conservar el orden.
+ *
+ * @param lista Lista a modificar.
+ * @param elemento Posición a quitar.
+ */
+static void Quitar(struct lista_s * lista, size_t elemento);
+
+/**
+ * @brief Busca una celda por su nombre.
+ *
+ * @param hoja Hoja donde buscar.
+ * @param nombre Caracteres del nombre.
+ * @param longitud Cantidad de caracteres del nombre.
+ * @param hash Dispersión del nombre.
+ * @return Lugar del índice donde está la celda, o el lugar libre donde debería insertarse.
+ */
+static size_t BuscarLugar(hoja_t hoja, const char * nombre, size_t longitud, uint64_t hash);
+
+/**
+ * @brief Agranda el arreglo de celdas, el índice de nombres y la pila de recorridos.
+ *
+ * @param hoja Hoja a agrandar.
+ * @return true si la hoja tiene lugar para una celda más, false si no se pudo asignar memoria.
+ */
+static bool Crecer(hoja_t hoja);
+
+/**
+ * @brief Busca una celda por su nombre y la crea como una entrada con valor 0 si no existe.
+ *
+ * @param hoja Hoja donde buscar.
+ * @param nombre Caracteres del nombre, que debe ser válido.
+ * @param longitud Cantidad de caracteres del nombre.
+ * @return Posición de la celda, o SIN_CELDA si no se pudo asignar memoria.
+ */
+static size_t ObtenerCelda(hoja_t hoja, const char * nombre, size_t longitud);
+
+/**
+ * @brief Quita las celdas creadas después de que la hoja tenía una cantidad dada de celdas.
+ *
+ * Las celdas se quitan en el orden inverso al que se crearon, de modo que al vaciar el lugar de cada una el índice
+ * queda igual que antes de insertarla y las secuencias de sondeo de las demás celdas no se cortan.
+ *
+ * @param hoja Hoja con las celdas.
+ * @param cantidad Cantidad de celdas que se conservan.
+ */
+static void Descartar(hoja_t hoja, size_t cantidad);
+
+/**
+ * @brief Traduce un nombre de una fórmula en compilación al índice de su parámetro.
+ *
+ * @param contexto Hoja donde se define la fórmula.
+ * @param nombre Caracteres del nombre.
+ * @param longitud Cantidad de caracteres del nombre.
+ * @return Índice del parámetro, o -1 si no se pudo asignar memoria.
+ */
+static int Resolver(void * contexto, const char * nombre, size_t longitud);
+
+/**
+ * @brief Indica si la fórmula en compilación haría que una celda dependa de sí misma.
+ *
+ * Recorre las celdas que dependen de la celda a definir, que en la práctica son pocas, y no las dependencias de la
+ * fórmula, que en una cadena larga de fórmulas pueden ser todas las celdas de la hoja.
+ *
+ * @param hoja Hoja con las celdas y las dependencias de la fórmula en compilación.
+ * @param celda Celda a la que se le asigna la fórmula.
+ * @return true si alguna dependencia de la fórmula es la propia celda o depende de ella.
+ */
+static bool Circular(hoja_t hoja, size_t celda);
+
+/**
+ * @brief Descarta la fórmula de una celda y la quita de las celdas de las que dependía.
+ *
+ * @param hoja Hoja con las celdas.
+ * @param celda Posición de la celda.
+ */
+static void Desvincular(hoja_t hoja, size_t celda);
+
+/**
+ * @brief Marca como desactualizadas todas las celdas que dependen de una celda.
+ *
+ * @param hoja Hoja con las celdas.
+ * @param origen Celda que cambió.
+ */
+static void Desactualizar(hoja_t hoja, size_t origen);
+
+/**
+ * @brief Evalúa la fórmula de una celda cuyas dependencias están actualizadas.
+ *
+ * @param hoja Hoja con las celdas.
+ * @param celda Posición de la celda.
+ */
+static void Evaluar(hoja_t hoja, size_t celda);
+
+/**
+ * @brief Actualiza una celda evaluando antes, en orden, las fórmulas desactualizadas de las que depende.
+ *
+ * @param hoja Hoja con las celdas.
+ * @param celda Posición de la celda.
+ */
+static void Actualizar(hoja_t hoja, size_t celda);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+uint64_t Dispersar(const char * nombre, size_t longitud) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    for (size_t i = 0; i < longitud; i++) {
+        hash = (hash ^ (unsigned char)nombre[i]) * 0x100000001B3ull;
+    }
+    return hash ^ (hash >> 32);
+}
+
+bool NombreValido(const char * nombre, size_t longitud) {
+    if ((longitud == 0) || (!isalpha((unsigned char)nombre[0]) && (nombre[0] != '_'))) {
+        return false;
+    }
+    for (size_t i = 1; i < longitud; i++) {
+        if (!isalnum((unsigned char)nombre[i]) && (nombre[i] != '_')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Reservar(struct lista_s * lista, size_t capacidad) {
+    if (capacidad <= lista->capacidad) {
+        return true;
+    }
+
+    size_t nueva = lista->capacidad ? 2 * lista->capacidad : 4;
+    if (nueva < capacidad) {
+        nueva = capacidad;
+    }
+    size_t * elementos = realloc(lista->elementos, nueva * sizeof(size_t));
+    if (!elementos) {
+        return false;
+    }
+    lista->elementos = elementos;
+    lista->capacidad = nueva;
+    return true;
+}
+
+void Quitar(struct lista_s * lista, size_t elemento) {
+    for (size_t i = 0; i < lista->cantidad; i++) {
+        if (lista->elementos[i] == elemento) {
+            lista->elementos[i] = lista->elementos[--lista->cantidad];
+            return;
+        }
+    }
+}
+
+size_t BuscarLugar(hoja_t hoja, const char * nombre, size_t longitud, uint64_t hash) {
+    size_t lugar = (size_t)hash & hoja->mascara;
+
+    while (hoja->indice[lugar] != SIN_CELDA) {
+        struct celda_s * celda = &hoja->celdas[hoja->indice[lugar]];
+        if ((celda->hash == hash) && (celda->longitud == longitud) && !memcmp(celda->nombre, nombre, longitud)) {
+            break;
+        }
+        lugar = (lugar + 1) & hoja->mascara;
+    }
+    return lugar;
+}
+
+bool Crecer(hoja_t hoja) {
+    size_t capacidad = 2 * hoja->capacidad;
+    size_t lugares = 2 * capacidad;
+
+    struct celda_s * celdas = realloc(hoja->celdas, capacidad * sizeof(struct celda_s));
+    if (!celdas) {
+        return false;
+    }
+    hoja->celdas = celdas;
+
+    size_t * indice = malloc(lugares * sizeof(size_t));
+    if (!indice || !Reservar(&hoja->pila, capacidad)) {
+        free(indice);
+        return false;
+    }
+    free(hoja->indice);
+    hoja->indice = indice;
+    hoja->mascara = lugares - 1;
+    hoja->capacidad = capacidad;
+
+    memset(hoja->indice, 0xFF, lugares * sizeof(size_t));
+    for (size_t i = 0; i < hoja->cantidad; i++) {
+        struct celda_s * celda = &hoja->celdas[i];
+        hoja->indice[BuscarLugar(hoja, celda->nombre, celda->longitud, celda->hash)] = i;
+    }
+    return true;
+}
+
+size_t ObtenerCelda(hoja_t hoja, const char * nombre, size_t longitud) {
+    uint64_t hash = Dispersar(nombre, longitud);
+    size_t lugar = BuscarLugar(hoja, nombre, longitud, hash);
+
+    if (hoja->indice[lugar] != SIN_CELDA) {
+        return hoja->indice[lugar];
+    }
+    if (hoja->cantidad == hoja->capacidad) {
+        if (!Crecer(hoja)) {
+            return SIN_CELDA;
+        }
+        lugar = BuscarLugar(hoja, nombre, longitud, hash);
+    }
+
+    char * copia = malloc(longitud + 1);
+    if (!copia) {
+        return SIN_CELDA;
+    }
+    memcpy(copia, nombre, longitud);
+    copia[longitud] = '\0';
+
+    size_t posicion = hoja->cantidad++;
+    hoja->celdas[posicion] = (struct celda_s){
+        .nombre = copia,
+        .longitud = longitud,
+        .hash = hash,
+        .estado = CALCULADORA_CORRECTO,
+    };
+    hoja->indice[lugar] = posicion;
+    return posicion;
+}
+
+void Descartar(hoja_t hoja, size_t cantidad) {
+    while (hoja->cantidad > cantidad) {
+        struct celda_s * celda = &hoja->celdas[--hoja->cantidad];
+        hoja->indice[BuscarLugar(hoja, celda->nombre, celda->longitud, celda->hash)] = SIN_CELDA;
+        free(celda->nombre);
+        free(celda->dependencias.elementos);
+        free(celda->dependientes.elementos);
+    }
+}
+
+int Resolver(void * contexto, const char * nombre, size_t longitud) {
+    hoja_t hoja = contexto;
+    size_t celda = ObtenerCelda(hoja, nombre, longitud);
+
+    if (celda == SIN_CELDA) {
+        return -1;
+    }
+    for (size_t i = 0; i < hoja->nuevas.cantidad; i++) {
+        if (hoja->nuevas.elementos[i] == celda) {
+            return (int)i;
+        }
+    }
+    if ((hoja->nuevas.cantidad >= INT_MAX) || !Reservar(&hoja->nuevas, hoja->nuevas.cantidad + 1)) {
+        return -1;
+    }
+    hoja->nuevas.elementos[hoja->nuevas.cantidad++] = celda;
+    return (int)(hoja->nuevas.cantidad - 1);
+}
+
+bool Circular(hoja_t hoja, size_t celda) {
+    uint32_t marca = ++hoja->marca;
+    struct lista_s * pila = &hoja->pila;
+
+    pila->cantidad = 0;
+    pila->elementos[pila->cantidad++] = celda;
+    hoja->celdas[celda].marca = marca;
+    while (pila->cantidad > 0) {
+        struct celda_s * actual = &hoja->celdas[pila->elementos[--pila->cantidad]];
+        for (size_t i = 0; i < actual->dependientes.cantidad; i++) {
+            size_t dependiente = actual->dependientes.elementos[i];
+            if (hoja->celdas[dependiente].marca != marca) {
+                hoja->celdas[dependiente].marca = marca;
+                pila->elementos[pila->cantidad++] = dependiente;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < hoja->nuevas.cantidad; i++) {
+        if (hoja->celdas[hoja->nuevas.elementos[i]].marca == marca) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Desvincular(hoja_t hoja, size_t celda) {
+    struct celda_s * actual = &hoja->celdas[celda];
+
+    for (size_t i = 0; i < actual->dependencias.cantidad; i++) {
+        Quitar(&hoja->celdas[actual->dependencias.elementos[i]].dependientes, celda);
+    }
+    actual->dependencias.cantidad = 0;
+    CalculadoraLiberarPrograma(hoja->calculadora, actual->programa);
+    actual->programa = NULL;
+}
+
+void Desactualizar(hoja_t hoja, size_t origen) {
+    struct lista_s * pila = &hoja->pila;
+
+    pila->cantidad = 0;
+    pila->elementos[pila->cantidad++] = origen;
+    while (pila->cantidad > 0) {
+        struct celda_s * celda = &hoja->celdas[pila->elementos[--pila->cantidad]];
+        for (size_t i = 0; i < celda->dependientes.cantidad; i++) {
+            struct celda_s * dependiente = &hoja->celdas[celda->dependientes.elementos[i]];
+            if (!dependiente->desactualizada) {
+                dependiente->desactualizada = true;
+                pila->elementos[pila->cantidad++] = celda->dependientes.elementos[i];
+            }
+        }
+    }
+}
+
+void Evaluar(hoja_t hoja, size_t celda) {
+    struct celda_s * actual = &hoja->celdas[celda];
+
+    actual->estado = CALCULADORA_CORRECTO;
+    for (size_t i = 0; i < actual->dependencias.cantidad; i++) {
+        struct celda_s * dependencia = &hoja->celdas[actual->dependencias.elementos[i]];
+        if (dependencia->estado != CALCULADORA_CORRECTO) {
+            actual->estado = dependencia->estado; // El error de una dependencia se propaga sin evaluar la fórmula
+            break;
+        }
+        hoja->valores[i] = dependencia->valor;
+    }
+
+    if (actual->estado == CALCULADORA_CORRECTO) {
+        actual->estado = CalculadoraEvaluarEstado(hoja->calculadora, actual->programa, hoja->valores, &actual->valor);
+        hoja->evaluaciones++;
+    } else {
+        actual->valor = 0;
+    }
+    actual->desactualizada = false;
+}
+
+void Actualizar(hoja_t hoja, size_t celda) {
+    uint32_t marca = ++hoja->marca;
+    struct lista_s * pila = &hoja->pila;
+
+    // Recorrido en profundidad en el que la pila es el camino desde la celda pedida: una celda está en la pila si
+    // tiene la marca del recorrido y está lista si ya no está desactualizada. Se baja por una dependencia
+    // desactualizada a la vez y una celda se evalúa recién cuando todas sus dependencias están listas
+    pila->cantidad = 0;
+    pila->elementos[pila->cantidad++] = celda;
+    hoja->celdas[celda].marca = marca;
+    hoja->celdas[celda].revisadas = 0;
+    while (pila->cantidad > 0) {
+        size_t tope = pila->elementos[pila->cantidad - 1];
+        struct celda_s * actual = &hoja->celdas[tope];
+        bool listas = true;
+
+        while (listas && (actual->revisadas < actual->dependencias.cantidad)) {
+            size_t siguiente = actual->dependencias.elementos[actual->revisadas++];
+            struct celda_s * dependencia = &hoja->celdas[siguiente];
+            // Una dependencia desactualizada con la marca estaría en el camino, lo que solo pasa con un ciclo
+            if (dependencia->desactualizada && (dependencia->marca != marca)) {
+                dependencia->marca = marca;
+                dependencia->revisadas = 0;
+                pila->elementos[pila->cantidad++] = siguiente;
+                listas = false;
+            }
+        }
+        if (listas) {
+            pila->cantidad--;
+            Evaluar(hoja, tope);
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+hoja_t HojaCrear(calculadora_t calculadora) {
+    if (!calculadora) {
+        return NULL;
+    }
+
+    hoja_t hoja = calloc(1, sizeof(struct hoja_s));
+    if (!hoja) {
+        return NULL;
+    }
+    hoja->calculadora = calculadora;
+    hoja->capacidad = CELDAS_INICIALES;
+    hoja->mascara = 2 * CELDAS_INICIALES - 1;
+    hoja->celdas = malloc(CELDAS_INICIALES * sizeof(struct celda_s));
+    hoja->indice = malloc(2 * CELDAS_INICIALES * sizeof(size_t));
+    if (!hoja->celdas || !hoja->indice || !Reservar(&hoja->pila, CELDAS_INICIALES)) {
+        HojaDestruir(hoja);
+        return NULL;
+    }
+    memset(hoja->indice, 0xFF, 2 * CELDAS_INICIALES * sizeof(size_t));
+    return hoja;
+}
+
+void HojaDestruir(hoja_t hoja) {
+    if (!hoja) {
+        return;
+    }
+
+    for (size_t i = 0; i < hoja->cantidad; i++) {
+        struct celda_s * celda = &hoja->celdas[i];
+        CalculadoraLiberarPrograma(hoja->calculadora, celda->programa);
+        free(celda->nombre);
+        free(celda->dependencias.elementos);
+        free(celda->dependientes.elementos);
+    }
+    free(hoja->celdas);
+    free(hoja->indice);
+    free(hoja->pila.elementos);
+    free(hoja->nuevas.elementos);
+    free(hoja->valores);
+    free(hoja);
+}
+
+bool HojaAsignar(hoja_t hoja, const char * nombre, int valor) {
+    if (!hoja || !nombre || !NombreValido(nombre, strlen(nombre))) {
+        return false;
+    }
+
+    size_t celda = ObtenerCelda(hoja, nombre, strlen(nombre));
+    if (celda == SIN_CELDA) {
+        return false;
+    }
+
+    struct celda_s * actual = &hoja->celdas[celda];
+    if (!actual->programa && (actual->estado == CALCULADORA_CORRECTO) && (actual->valor == valor)) {
+        return true; // Sin cambios, las fórmulas que dependen de la celda siguen actualizadas
+    }
+
+    Desvincular(hoja, celda);
+    actual->valor = valor;
+    actual->estado = CALCULADORA_CORRECTO;
+    actual->desactualizada = false;
+    Desactualizar(hoja, celda);
+    return true;
+}
+
+calculadora_estado_t HojaDefinir(hoja_t hoja, const char * definicion) {
+    calculadora_estado_t estado;
+
+    if (!hoja || !definicion) {
+        return CALCULADORA_EXPRESION_INVALIDA;
+    }
+
+    const char * nombre = definicion;
+    while (isspace((unsigned char)*nombre)) {
+        nombre++;
+    }
+    const char * cursor = nombre;
+    while (isalnum((unsigned char)*cursor) || (*cursor == '_')) {
+        cursor++;
+    }
+    size_t longitud = (size_t)(cursor - nombre);
+    while (isspace((unsigned char)*cursor)) {
+        cursor++;
+    }
+    if ((*cursor != '=') || !NombreValido(nombre, longitud)) {
+        return CALCULADORA_EXPRESION_INVALIDA; // Error: falta el nombre o el signo '='
+    }
+
+    // Una definición rechazada no deja las celdas que se crearon al resolver sus nombres
+    size_t anteriores = hoja->cantidad;
+    hoja->nuevas.cantidad = 0;
+    programa_t programa = CalculadoraCompilarNombres(hoja->calculadora, cursor + 1, Resolver, hoja, &estado);
+    if (!programa) {
+        Descartar(hoja, anteriores);
+        return (estado == CALCULADORA_CORRECTO) ? CALCULADORA_EXPRESION_INVALIDA : estado;
+    }
+
+    size_t celda = ObtenerCelda(hoja, nombre, longitud);
+    bool valida = (celda != SIN_CELDA) && !Circular(hoja, celda) &&
+                  Reservar(&hoja->celdas[celda].dependencias, hoja->nuevas.cantidad);
+    for (size_t i = 0; valida && (i < hoja->nuevas.cantidad); i++) {
+        struct celda_s * dependencia = &hoja->celdas[hoja->nuevas.elementos[i]];
+        valida = Reservar(&dependencia->dependientes, dependencia->dependientes.cantidad + 1);
+    }
+    if (valida && (hoja->nuevas.cantidad > hoja->capacidad_valores)) {
+        int * valores = realloc(hoja->valores, hoja->nuevas.cantidad * sizeof(int));
+        valida = (valores != NULL);
+        if (valida) {
+            hoja->valores = valores;
+            hoja->capacidad_valores = hoja->nuevas.cantidad;
+        }
+    }
+    if (!valida) {
+        CalculadoraLiberarPrograma(hoja->calculadora, programa);
+        Descartar(hoja, anteriores);
+        return CALCULADORA_EXPRESION_INVALIDA; // Error: definición circular o falta de memoria
+    }
+
+    Desvincular(hoja, celda);
+    struct celda_s * actual = &hoja->celdas[celda];
+    for (size_t i = 0; i < hoja->nuevas.cantidad; i++) {
+        struct celda_s * dependencia = &hoja->celdas[hoja->nuevas.elementos[i]];
+        dependencia->dependientes.elementos[dependencia->dependientes.cantidad++] = celda;
+        actual->dependencias.elementos[i] = hoja->nuevas.elementos[i];
+    }
+    actual->dependencias.cantidad = hoja->nuevas.cantidad;
+    actual->programa = programa;
+    actual->desactualizada = true;
+    Desactualizar(hoja, celda);
+    return CALCULADORA_CORRECTO;
+}
+
+calculadora_estado_t HojaValor(hoja_t hoja, const char * nombre, int * valor) {
+    calculadora_estado_t estado = CALCULADORA_EXPRESION_INVALIDA;
+
+    if (hoja && nombre) {
+        size_t longitud = strlen(nombre);
+        size_t lugar = BuscarLugar(hoja, nombre, longitud, Dispersar(nombre, longitud));
+        size_t celda = hoja->indice[lugar];
+        if (celda != SIN_CELDA) {
+            if (hoja->celdas[celda].desactualizada) {
+                Actualizar(hoja, celda);
+            }
+            estado = hoja->celdas[celda].estado;
+        }
+        if (valor) {
+            *valor = ((estado == CALCULADORA_CORRECTO) ? hoja->celdas[celda].valor : 0);
+        }
+    } else if (valor) {
+        *valor = 0;
+    }
+    return estado;
+}
+
+uint64_t HojaEvaluaciones(hoja_t hoja) {
+    return hoja ? hoja->evaluaciones : 0;
+}
+
+/* === End of documentation ======================================================================================== */
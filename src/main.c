@@ -24,7 +24,11 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "alumno.h"
+#include "flujo.h"
+#include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 #include <calculadora.h>
 
 /* === Macros definitions ========================================================================================== */
@@ -44,13 +48,16 @@ SPDX-License-Identifier: MIT
 /**
  * @brief Función principal del programa.
  *
- * Se crea una instancia de calculadora, se registran las operaciones básicas (+, -, *) y luego
- * se evalúan tres expresiones aritméticas como ejemplo.
+ * Se crea una instancia de calculadora y se registran las operaciones básicas (+, -, *, /). Sin argumentos se
+ * evalúan cuatro expresiones aritméticas como ejemplo. Con un argumento se evalúa en modo flujo el archivo indicado,
+ * o la entrada estándar si el argumento es "-", escribiendo un resultado por línea en la salida estándar.
  *
- * @return 0 al finalizar correctamente.
+ * @param argc Cantidad de argumentos de la línea de comandos.
+ * @param argv Argumentos de la línea de comandos.
+ * @return 0 al finalizar correctamente, 1 si hubo un error en el modo flujo.
  */
 
-int main(void) {
+int main(int argc, char * argv[]) {
     // Expresiones a evaluar
     static const char suma [] = "22+33";
     static const char resta [] = "5+4";
@@ -66,13 +73,28 @@ int main(void) {
     CalculadoraAddOperacion(calculadora, '*', OperacionMul);
     CalculadoraAddOperacion(calculadora, '/', OperacionDiv);
 
+    // Modo flujo: evaluar un archivo de expresiones, una por línea
+    if (argc > 1) {
+        int entrada = strcmp(argv[1], "-") ? open(argv[1], O_RDONLY) : STDIN_FILENO;
+        bool correcto = (entrada >= 0) && FlujoEvaluar(calculadora, entrada, STDOUT_FILENO);
+        if (entrada > STDIN_FILENO) {
+            close(entrada);
+        }
+        if (!correcto) {
+            perror(argv[1]);
+        }
+        CalculadoraDestruir(calculadora);
+        return correcto ? 0 : 1;
+    }
+
     // Evaluar expresiones y mostrar resultados
 
     printf ("Resultado de la suma: %d\n", CalculadoraCalcula(calculadora, suma));
     printf ("Resultado de la resta: %d\n", CalculadoraCalcula(calculadora, resta));
     printf ("Resultado de la multiplicacion: %d\n", CalculadoraCalcula(calculadora, multiplicacion));
     printf ("Resultado de la division: %d\n", CalculadoraCalcula(calculadora, division));
-    
+
+    CalculadoraDestruir(calculadora);
     return 0;
 
 }
@@ -0,0 +1,247 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file medicion.c
+ ** @brief codigo fuente del módulo de contadores de uso y de latencia por hilo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "medicion.h"
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define MEDICIONES_LOCALES 8 //!< mediciones cuyos contadores recuerda cada hilo
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Conjunto de mediciones.
+ *
+ * Los bloques de los hilos forman una lista a la que solo se agregan elementos, con una operación atómica, hasta que
+ * se destruye el conjunto.
+ */
+
+struct medicion_s {
+    uint64_t identificador;            //!< número único del conjunto, distinto para cada conjunto creado
+    _Atomic(medicion_hilo_t) hilos;    //!< lista de contadores de los hilos
+};
+
+/**
+ * @brief Contadores de un conjunto de mediciones que recuerda un hilo.
+ */
+
+struct medicion_local_s {
+    uint64_t identificador; //!< identificador del conjunto, 0 si la posición está libre
+    medicion_hilo_t hilo;   //!< contadores del hilo en ese conjunto
+};
+
+/**
+ * @brief Texto JSON en construcción.
+ */
+
+struct salida_s {
+    char * buffer;   //!< buffer donde se escribe el texto
+    size_t size;     //!< tamaño del buffer
+    size_t longitud; //!< caracteres escritos hasta el momento
+    bool completa;   //!< false si algún texto no entró en el buffer
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Busca los contadores que el hilo que llama tiene en un conjunto, o los crea y los agrega a la lista.
+ *
+ * @param medicion Conjunto de mediciones.
+ * @return Contadores del hilo, o NULL si no se pudo asignar memoria.
+ */
+
+static medicion_hilo_t BuscarHilo(medicion_t medicion);
+
+/**
+ * @brief Agrega texto con formato al final de la salida.
+ *
+ * @param salida Texto en construcción.
+ * @param formato Formato del texto, como en printf.
+ */
+
+static void Escribir(struct salida_s * salida, const char * formato, ...);
+
+/**
+ * @brief Agrega un operador como clave JSON, escapando los caracteres que lo requieren.
+ *
+ * @param salida Texto en construcción.
+ * @param operador Carácter del operador.
+ */
+
+static void EscribirOperador(struct salida_s * salida, unsigned char operador);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Último identificador asignado a un conjunto de mediciones
+static _Atomic uint64_t ultimo_identificador;
+
+//! Contadores de las últimas mediciones usadas por el hilo, ubicados según el identificador del conjunto
+static _Thread_local struct medicion_local_s locales[MEDICIONES_LOCALES];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static medicion_hilo_t BuscarHilo(medicion_t medicion) {
+    medicion_hilo_t hilo = atomic_load_explicit(&medicion->hilos, memory_order_acquire);
+
+    // Un hilo que termina deja libre su dirección de locales para otro hilo, que puede seguir usando sus contadores
+    for (; hilo; hilo = hilo->siguiente) {
+        if (hilo->dueno == locales) {
+            return hilo;
+        }
+    }
+
+    hilo = calloc(1, sizeof(struct medicion_hilo_s));
+    if (hilo) {
+        hilo->dueno = locales;
+        hilo->siguiente = atomic_load_explicit(&medicion->hilos, memory_order_relaxed);
+        while (!atomic_compare_exchange_weak_explicit(&medicion->hilos, &hilo->siguiente, hilo, memory_order_release,
+                                                      memory_order_relaxed)) {
+        }
+    }
+    return hilo;
+}
+
+static void Escribir(struct salida_s * salida, const char * formato, ...) {
+    va_list argumentos;
+
+    if (!salida->completa) {
+        return;
+    }
+
+    va_start(argumentos, formato);
+    int escritos = vsnprintf(salida->buffer + salida->longitud, salida->size - salida->longitud, formato, argumentos);
+    va_end(argumentos);
+
+    if ((escritos < 0) || ((size_t)escritos >= salida->size - salida->longitud)) {
+        salida->completa = false;
+    } else {
+        salida->longitud += (size_t)escritos;
+    }
+}
+
+static void EscribirOperador(struct salida_s * salida, unsigned char operador) {
+    if ((operador == '"') || (operador == '\\')) {
+        Escribir(salida, "\"\\%c\"", operador);
+    } else if ((operador < 0x20) || (operador >= 0x7F)) {
+        Escribir(salida, "\"\\u%04x\"", operador);
+    } else {
+        Escribir(salida, "\"%c\"", operador);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+medicion_t MedicionCrear(void) {
+    medicion_t medicion = malloc(sizeof(struct medicion_s));
+
+    if (medicion) {
+        medicion->identificador = atomic_fetch_add_explicit(&ultimo_identificador, 1, memory_order_relaxed) + 1;
+        atomic_init(&medicion->hilos, NULL);
+    }
+    return medicion;
+}
+
+void MedicionDestruir(medicion_t medicion) {
+    if (!medicion) {
+        return;
+    }
+
+    for (medicion_hilo_t hilo = atomic_load_explicit(&medicion->hilos, memory_order_acquire); hilo;) {
+        medicion_hilo_t siguiente = hilo->siguiente;
+        free(hilo);
+        hilo = siguiente;
+    }
+    free(medicion);
+}
+
+medicion_hilo_t MedicionHilo(medicion_t medicion) {
+    struct medicion_local_s * local = &locales[medicion->identificador % MEDICIONES_LOCALES];
+
+    // El identificador no se repite entre conjuntos, así que una posición de un conjunto ya destruido nunca coincide
+    if (local->identificador != medicion->identificador) {
+        medicion_hilo_t hilo = BuscarHilo(medicion);
+        if (!hilo) {
+            return NULL;
+        }
+        local->identificador = medicion->identificador;
+        local->hilo = hilo;
+    }
+    return local->hilo;
+}
+
+int MedicionSerializar(medicion_t medicion, char buffer[], size_t size) {
+    struct salida_s salida = {.buffer = buffer, .size = size, .completa = (buffer != NULL) && (size > 0)};
+    uint64_t llamadas[MEDICION_OPERADORES] = {0};
+    uint64_t errores[MEDICION_OPERADORES] = {0};
+    uint64_t latencias[MEDICION_CUBETAS] = {0};
+    uint64_t calculos = 0;
+    const char * separador = "";
+
+    if (!medicion) {
+        return -1;
+    }
+
+    for (medicion_hilo_t hilo = atomic_load_explicit(&medicion->hilos, memory_order_acquire); hilo;
+         hilo = hilo->siguiente) {
+        for (int operador = 0; operador < MEDICION_OPERADORES; operador++) {
+            llamadas[operador] += atomic_load_explicit(&hilo->llamadas[operador], memory_order_relaxed);
+            errores[operador] += atomic_load_explicit(&hilo->errores[operador], memory_order_relaxed);
+        }
+        for (int cubeta = 0; cubeta < MEDICION_CUBETAS; cubeta++) {
+            latencias[cubeta] += atomic_load_explicit(&hilo->latencias[cubeta], memory_order_relaxed);
+        }
+    }
+    for (int cubeta = 0; cubeta < MEDICION_CUBETAS; cubeta++) {
+        calculos += latencias[cubeta];
+    }
+
+    Escribir(&salida, "{\"calculos\":%" PRIu64 ",\"operaciones\":{", calculos);
+    for (int operador = 0; operador < MEDICION_OPERADORES; operador++) {
+        if (llamadas[operador] || errores[operador]) {
+            Escribir(&salida, "%s", separador);
+            EscribirOperador(&salida, (unsigned char)operador);
+            Escribir(&salida, ":{\"llamadas\":%" PRIu64 ",\"errores\":%" PRIu64 "}", llamadas[operador],
+                     errores[operador]);
+            separador = ",";
+        }
+    }
+    Escribir(&salida, "},\"latencias\":[");
+    for (int cubeta = 0; cubeta < MEDICION_CUBETAS; cubeta++) {
+        Escribir(&salida, "%s%" PRIu64, cubeta ? "," : "", latencias[cubeta]);
+    }
+    Escribir(&salida, "]}");
+
+    return salida.completa ? (int)salida.longitud : -1;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,286 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file padron.c
+ ** @brief codigo fuente del módulo de padrones de alumnos guardados por columnas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "padron.h"
+#include "textos.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PADRON_X86 //!< se compilan las implementaciones con extensiones SIMD de x86
+#endif
+
+/* === Macros definitions ========================================================================================== */
+
+#define FILAS_INICIALES 64 //!< cantidad de filas para las que se reserva memoria al agregar la primera
+
+/**
+ * @brief Define una implementación SIMD del filtro por rango de documento.
+ *
+ * Un documento está en el rango cuando documento - minimo, sin signo, no supera maximo - minimo, lo que equivale a
+ * min(documento - minimo, maximo - minimo) == documento - minimo. Cada comparación da una máscara con un bit por
+ * carril y se recorren solo los bits encendidos; los documentos que sobran se terminan con la versión escalar.
+ *
+ * @param nombre Nombre de la función a definir.
+ * @param extension Extensión del procesador que necesita la función, como se indica en el atributo target.
+ * @param tipo Tipo de registro SIMD.
+ * @param ancho Cantidad de enteros que entran en un registro.
+ * @param cargar Instrucción de carga no alineada.
+ * @param repetir Instrucción que copia un entero en todos los carriles.
+ * @param restar Instrucción que resta dos registros carril a carril.
+ * @param menor Instrucción que calcula el mínimo sin signo carril a carril.
+ * @param iguales Instrucción que compara dos registros carril a carril.
+ * @param mascara Instrucción que junta el bit más alto de cada carril en un entero.
+ */
+#define FILTRO_SIMD(nombre, extension, tipo, ancho, cargar, repetir, restar, menor, iguales, mascara)                  \
+    __attribute__((target(extension))) static size_t nombre(const uint32_t documentos[], size_t n, uint32_t minimo,    \
+                                                            uint32_t maximo, uint32_t filas[]) {                       \
+        tipo base = repetir((int)minimo);                                                                              \
+        tipo ancho_rango = repetir((int)(maximo - minimo));                                                            \
+        size_t encontradas = 0;                                                                                        \
+        size_t i = 0;                                                                                                  \
+        for (; i + (ancho) <= n; i += (ancho)) {                                                                       \
+            tipo desplazados = restar(cargar((const tipo *)(documentos + i)), base);                                   \
+            unsigned bits = (unsigned)mascara(iguales(menor(desplazados, ancho_rango), desplazados));                  \
+            while (bits) {                                                                                             \
+                filas[encontradas++] = (uint32_t)(i + (unsigned)__builtin_ctz(bits));                                  \
+                bits &= bits - 1;                                                                                      \
+            }                                                                                                          \
+        }                                                                                                              \
+        encontradas += FiltrarGenerico(documentos + i, n - i, minimo, maximo, filas + encontradas, i);                 \
+        return encontradas;                                                                                            \
+    }
+
+/* === Private data type declarations ============================================================================== */
+
+//! Función que guarda las filas cuyos documentos están en el rango [minimo, maximo]
+typedef size_t (*padron_filtro_t)(const uint32_t documentos[], size_t n, uint32_t minimo, uint32_t maximo,
+                                  uint32_t filas[]);
+
+/**
+ * @brief Padrón con una columna por cada dato de los alumnos.
+ */
+
+struct padron_s {
+    uint32_t * documentos;                  //!< columna de documentos, contigua para recorrerla con SIMD
+    texto_t * nombres;                      //!< columna de nombres, una referencia propia por fila
+    texto_t * apellidos;                    //!< columna de apellidos, una referencia propia por fila
+    size_t cantidad;                        //!< cantidad de filas
+    size_t capacidad;                       //!< cantidad de filas que entran sin volver a asignar memoria
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Filtro por rango de documento escalar, que se usa sin extensiones SIMD y para los documentos que sobran.
+ *
+ * @param documentos Documentos a recorrer.
+ * @param n Cantidad de documentos.
+ * @param minimo Menor documento incluido en el rango.
+ * @param maximo Mayor documento incluido en el rango.
+ * @param filas Arreglo donde se guardan las filas encontradas.
+ * @param primera Fila del primer documento recorrido.
+ * @return Cantidad de filas encontradas.
+ */
+static size_t FiltrarGenerico(const uint32_t documentos[], size_t n, uint32_t minimo, uint32_t maximo,
+                              uint32_t filas[], size_t primera);
+
+/**
+ * @brief Filtro escalar con la firma de las implementaciones SIMD.
+ */
+static size_t FiltrarEscalar(const uint32_t documentos[], size_t n, uint32_t minimo, uint32_t maximo,
+                             uint32_t filas[]);
+
+/**
+ * @brief Elige la implementación del filtro según las extensiones del procesador en uso.
+ */
+static void ElegirFiltro(void);
+
+/**
+ * @brief Asegura que el padrón tenga lugar para una fila más, duplicando sus columnas si hace falta.
+ *
+ * @param padron Padrón a agrandar.
+ * @return true si hay lugar, false si no se pudo asignar memoria.
+ */
+static bool Agrandar(padron_t padron);
+
+/* === Private variable definitions ================================================================================ */
+
+static padron_filtro_t filtro = FiltrarEscalar; //!< implementación del filtro elegida para el procesador en uso
+
+static pthread_once_t filtro_elegido = PTHREAD_ONCE_INIT; //!< asegura que la implementación se elige una sola vez
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+size_t FiltrarGenerico(const uint32_t documentos[], size_t n, uint32_t minimo, uint32_t maximo, uint32_t filas[],
+                       size_t primera) {
+    size_t encontradas = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        filas[encontradas] = (uint32_t)(primera + i);
+        encontradas += (documentos[i] - minimo <= maximo - minimo);
+    }
+    return encontradas;
+}
+
+size_t FiltrarEscalar(const uint32_t documentos[], size_t n, uint32_t minimo, uint32_t maximo, uint32_t filas[]) {
+    return FiltrarGenerico(documentos, n, minimo, maximo, filas, 0);
+}
+
+#ifdef PADRON_X86
+
+/**
+ * @brief Junta el bit más alto de cada carril de 32 bits de un registro SSE en un entero de 4 bits.
+ */
+__attribute__((target("sse4.1"))) static inline int MascaraSse(__m128i x) {
+    return _mm_movemask_ps(_mm_castsi128_ps(x));
+}
+
+/**
+ * @brief Junta el bit más alto de cada carril de 32 bits de un registro AVX2 en un entero de 8 bits.
+ */
+__attribute__((target("avx2"))) static inline int MascaraAvx2(__m256i x) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(x));
+}
+
+FILTRO_SIMD(FiltrarSse, "sse4.1", __m128i, 4, _mm_loadu_si128, _mm_set1_epi32, _mm_sub_epi32, _mm_min_epu32,
+            _mm_cmpeq_epi32, MascaraSse)
+
+FILTRO_SIMD(FiltrarAvx2, "avx2", __m256i, 8, _mm256_loadu_si256, _mm256_set1_epi32, _mm256_sub_epi32,
+            _mm256_min_epu32, _mm256_cmpeq_epi32, MascaraAvx2)
+
+#endif
+
+void ElegirFiltro(void) {
+#ifdef PADRON_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        filtro = FiltrarAvx2;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        filtro = FiltrarSse;
+    }
+#endif
+}
+
+bool Agrandar(padron_t padron) {
+    if (padron->cantidad < padron->capacidad) {
+        return true;
+    }
+
+    size_t capacidad = (padron->capacidad == 0) ? FILAS_INICIALES : 2 * padron->capacidad;
+    uint32_t * documentos = realloc(padron->documentos, capacidad * sizeof(padron->documentos[0]));
+    if (documentos == NULL) {
+        return false;
+    }
+    padron->documentos = documentos;
+
+    texto_t * nombres = realloc(padron->nombres, capacidad * sizeof(padron->nombres[0]));
+    if (nombres == NULL) {
+        return false;
+    }
+    padron->nombres = nombres;
+
+    texto_t * apellidos = realloc(padron->apellidos, capacidad * sizeof(padron->apellidos[0]));
+    if (apellidos == NULL) {
+        return false;
+    }
+    padron->apellidos = apellidos;
+
+    padron->capacidad = capacidad;
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+padron_t PadronCrear(void) {
+    return calloc(1, sizeof(struct padron_s));
+}
+
+void PadronDestruir(padron_t padron) {
+    if (padron) {
+        for (size_t fila = 0; fila < padron->cantidad; fila++) {
+            TextosLiberar(padron->nombres[fila]);
+            TextosLiberar(padron->apellidos[fila]);
+        }
+        free(padron->documentos);
+        free(padron->nombres);
+        free(padron->apellidos);
+        free(padron);
+    }
+}
+
+bool PadronAgregar(padron_t padron, alumno_t alumno) {
+    if (!padron || !alumno || (padron->cantidad >= UINT32_MAX) || !Agrandar(padron)) {
+        return false;
+    }
+
+    // Internar los textos del alumno los encuentra en la tabla y toma una referencia más, sin copiarlos, para que la
+    // fila siga siendo válida después de destruir al alumno
+    texto_t nombre = TextosInternar(AlumnoNombre(alumno), strlen(AlumnoNombre(alumno)));
+    texto_t apellido = TextosInternar(AlumnoApellido(alumno), strlen(AlumnoApellido(alumno)));
+    if ((nombre == TEXTO_INVALIDO) || (apellido == TEXTO_INVALIDO)) {
+        TextosLiberar(nombre);
+        TextosLiberar(apellido);
+        return false;
+    }
+
+    size_t fila = padron->cantidad;
+    padron->documentos[fila] = AlumnoDocumento(alumno);
+    padron->nombres[fila] = nombre;
+    padron->apellidos[fila] = apellido;
+    padron->cantidad++;
+    return true;
+}
+
+size_t PadronCantidad(padron_t padron) {
+    return padron->cantidad;
+}
+
+uint32_t PadronDocumento(padron_t padron, size_t fila) {
+    return padron->documentos[fila];
+}
+
+const char * PadronNombre(padron_t padron, size_t fila) {
+    return TextosCadena(padron->nombres[fila]);
+}
+
+const char * PadronApellido(padron_t padron, size_t fila) {
+    return TextosCadena(padron->apellidos[fila]);
+}
+
+size_t PadronFiltrarDocumento(padron_t padron, uint32_t minimo, uint32_t maximo, uint32_t filas[]) {
+    if (minimo > maximo) {
+        return 0;
+    }
+    pthread_once(&filtro_elegido, ElegirFiltro);
+    return filtro(padron->documentos, padron->cantidad, minimo, maximo, filas);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,369 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file paralelo.c
+ ** @brief codigo fuente del módulo para repartir trabajo entre varios hilos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "paralelo.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define RANGO(inicio, fin) (((uint64_t)(inicio) << 32) | (uint32_t)(fin)) //!< empaqueta un rango de bloques
+
+#define RANGO_INICIO(rango) ((uint32_t)((rango) >> 32)) //!< primer bloque pendiente de un rango empaquetado
+
+#define RANGO_FIN(rango) ((uint32_t)(rango)) //!< bloque siguiente al último de un rango empaquetado
+
+#define BLOQUES_MAX UINT32_MAX //!< cantidad máxima de bloques que se reparten en una sola ronda
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Porción de bloques asignada a un hilo.
+ *
+ * El inicio y el fin se empaquetan en una única palabra atómica: el dueño avanza el inicio y los demás hilos
+ * recortan el fin para robar, ambos con una comparación e intercambio sobre la palabra completa.
+ */
+
+struct porcion_s {
+    _Alignas(64) _Atomic uint64_t rango; //!< rango [inicio, fin) de bloques pendientes, en su propia línea de caché
+};
+
+/**
+ * @brief Trabajo compartido por todos los hilos de una ronda.
+ */
+
+typedef struct trabajo_s {
+    paralelo_tarea_t tarea;                     //!< función que procesa cada bloque
+    void * contexto;                            //!< contexto de la tarea
+    size_t base;                                //!< primer índice de la ronda
+    size_t cantidad;                            //!< cantidad de índices de la ronda
+    size_t bloque;                              //!< cantidad de índices por bloque
+    size_t hilos;                               //!< cantidad de hilos de la ronda
+    struct porcion_s porciones[PARALELO_HILOS_MAX]; //!< porción de bloques de cada hilo
+} * trabajo_t;
+
+/**
+ * @brief Argumento de cada hilo trabajador.
+ */
+
+struct trabajador_s {
+    trabajo_t trabajo; //!< trabajo compartido
+    size_t indice;     //!< porción propia del hilo
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Toma el siguiente bloque de una porción.
+ *
+ * @param porcion Porción de la que se toma el bloque.
+ * @param bloque Variable donde se guarda el número de bloque tomado.
+ * @return true si se tomó un bloque, false si la porción estaba vacía.
+ */
+static bool TomarBloque(struct porcion_s * porcion, uint32_t * bloque);
+
+/**
+ * @brief Roba la mitad de los bloques pendientes del hilo más atrasado y los deja en la porción propia.
+ *
+ * @param trabajo Trabajo compartido.
+ * @param indice Porción propia del hilo que roba.
+ * @return true si se robaron bloques, false si ya no queda trabajo pendiente.
+ */
+static bool RobarBloques(trabajo_t trabajo, size_t indice);
+
+/**
+ * @brief Procesa bloques de la porción propia y roba de las demás hasta que no queda trabajo.
+ *
+ * @param argumento Puntero a la estructura trabajador_s del hilo.
+ * @return Siempre NULL.
+ */
+static void * Trabajar(void * argumento);
+
+/**
+ * @brief Cuerpo de cada hilo del grupo permanente: espera una ronda, trabaja en su porción y vuelve a esperar.
+ *
+ * @param argumento Índice de la porción que le corresponde al hilo en cada ronda, convertido a puntero.
+ * @return Nunca retorna.
+ */
+static void * Esperar(void * argumento);
+
+/**
+ * @brief Agrega hilos al grupo permanente hasta tener la cantidad pedida, con el grupo tomado.
+ *
+ * @param hilos Cantidad de hilos del grupo deseada, sin contar al hilo que llama a ParaleloEjecutar.
+ */
+static void AgrandarGrupo(size_t hilos);
+
+/**
+ * @brief Olvida los hilos del grupo en el proceso hijo después de un fork, donde esos hilos ya no existen.
+ */
+static void ReiniciarGrupo(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static _Atomic size_t hilos_limite = 0; //!< límite de hilos configurado, 0 si no hay límite
+
+static pthread_mutex_t grupo_uso = PTHREAD_MUTEX_INITIALIZER; //!< lo toma la llamada que usa el grupo permanente
+
+static pthread_mutex_t grupo_cerrojo = PTHREAD_MUTEX_INITIALIZER; //!< protege el estado de la ronda del grupo
+
+static pthread_cond_t grupo_aviso = PTHREAD_COND_INITIALIZER; //!< despierta a los hilos cuando empieza una ronda
+
+static pthread_cond_t grupo_fin = PTHREAD_COND_INITIALIZER; //!< avisa al que llama que terminaron los hilos
+
+static trabajo_t grupo_trabajo = NULL; //!< trabajo de la ronda en curso
+
+static uint64_t grupo_ronda = 0; //!< número de la última ronda publicada
+
+static size_t grupo_participantes = 0; //!< hilos de la ronda en curso, contando al que llama
+
+static size_t grupo_pendientes = 0; //!< hilos del grupo que todavía trabajan en la ronda en curso
+
+static size_t grupo_hilos = 0; //!< hilos creados en el grupo, sin contar al que llama
+
+static uint64_t grupo_vistas[PARALELO_HILOS_MAX]; //!< ronda con la que empieza a esperar cada hilo del grupo
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+bool TomarBloque(struct porcion_s * porcion, uint32_t * bloque) {
+    uint64_t rango = atomic_load_explicit(&porcion->rango, memory_order_acquire);
+
+    while (RANGO_INICIO(rango) < RANGO_FIN(rango)) {
+        uint64_t nuevo = RANGO(RANGO_INICIO(rango) + 1, RANGO_FIN(rango));
+        if (atomic_compare_exchange_weak_explicit(&porcion->rango, &rango, nuevo, memory_order_acq_rel,
+                                                  memory_order_acquire)) {
+            *bloque = RANGO_INICIO(rango);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RobarBloques(trabajo_t trabajo, size_t indice) {
+    while (true) {
+        size_t victima = indice;
+        uint32_t pendientes = 0;
+        uint64_t rango = 0;
+
+        for (size_t i = 0; i < trabajo->hilos; i++) {
+            uint64_t actual = atomic_load_explicit(&trabajo->porciones[i].rango, memory_order_acquire);
+            if ((i != indice) && (RANGO_FIN(actual) - RANGO_INICIO(actual) > pendientes) &&
+                (RANGO_INICIO(actual) < RANGO_FIN(actual))) {
+                victima = i;
+                rango = actual;
+                pendientes = RANGO_FIN(actual) - RANGO_INICIO(actual);
+            }
+        }
+        if (pendientes == 0) {
+            return false;
+        }
+
+        uint32_t robados = (pendientes + 1) / 2;
+        uint32_t corte = RANGO_FIN(rango) - robados;
+        if (atomic_compare_exchange_strong_explicit(&trabajo->porciones[victima].rango, &rango,
+                                                    RANGO(RANGO_INICIO(rango), corte), memory_order_acq_rel,
+                                                    memory_order_acquire)) {
+            atomic_store_explicit(&trabajo->porciones[indice].rango, RANGO(corte, RANGO_FIN(rango)),
+                                  memory_order_release);
+            return true;
+        }
+    }
+}
+
+void * Trabajar(void * argumento) {
+    struct trabajador_s * trabajador = argumento;
+    trabajo_t trabajo = trabajador->trabajo;
+    uint32_t bloque;
+
+    do {
+        while (TomarBloque(&trabajo->porciones[trabajador->indice], &bloque)) {
+            size_t inicio = (size_t)bloque * trabajo->bloque;
+            size_t fin = inicio + trabajo->bloque;
+            if (fin > trabajo->cantidad) {
+                fin = trabajo->cantidad;
+            }
+            trabajo->tarea(trabajo->contexto, trabajo->base + inicio, trabajo->base + fin);
+        }
+    } while (RobarBloques(trabajo, trabajador->indice));
+
+    return NULL;
+}
+
+void * Esperar(void * argumento) {
+    size_t indice = (size_t)(uintptr_t)argumento;
+    uint64_t vista = grupo_vistas[indice];
+
+    while (true) {
+        pthread_mutex_lock(&grupo_cerrojo);
+        while (grupo_ronda == vista) {
+            pthread_cond_wait(&grupo_aviso, &grupo_cerrojo);
+        }
+        vista = grupo_ronda;
+        struct trabajador_s trabajador = {.trabajo = grupo_trabajo, .indice = indice};
+        bool participa = (indice < grupo_participantes);
+        pthread_mutex_unlock(&grupo_cerrojo);
+
+        // Los hilos que sobran en una ronda chica no tocan el trabajo, que puede dejar de existir en cualquier momento
+        if (participa) {
+            Trabajar(&trabajador);
+            pthread_mutex_lock(&grupo_cerrojo);
+            if (--grupo_pendientes == 0) {
+                pthread_cond_signal(&grupo_fin);
+            }
+            pthread_mutex_unlock(&grupo_cerrojo);
+        }
+    }
+    return NULL;
+}
+
+void AgrandarGrupo(size_t hilos) {
+    static bool registrado = false;
+
+    if (!registrado) {
+        registrado = (pthread_atfork(NULL, NULL, ReiniciarGrupo) == 0);
+    }
+    while (registrado && (grupo_hilos < hilos)) {
+        pthread_t hilo;
+        size_t indice = grupo_hilos + 1;
+
+        grupo_vistas[indice] = grupo_ronda;
+        if (pthread_create(&hilo, NULL, Esperar, (void *)(uintptr_t)indice) != 0) {
+            return;
+        }
+        pthread_detach(hilo);
+        grupo_hilos++;
+    }
+}
+
+void ReiniciarGrupo(void) {
+    pthread_mutex_init(&grupo_uso, NULL);
+    pthread_mutex_init(&grupo_cerrojo, NULL);
+    pthread_cond_init(&grupo_aviso, NULL);
+    pthread_cond_init(&grupo_fin, NULL);
+    grupo_hilos = 0;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void ParaleloEjecutar(size_t cantidad, size_t bloque, paralelo_tarea_t tarea, void * contexto) {
+    if (!tarea || cantidad == 0) {
+        return;
+    }
+    if (bloque == 0) {
+        bloque = 1;
+    }
+
+    size_t hilos_disponibles = ParaleloHilos();
+    if ((hilos_disponibles == 1) || (cantidad <= bloque)) {
+        tarea(contexto, 0, cantidad);
+        return;
+    }
+
+    struct trabajo_s trabajo = {.tarea = tarea, .contexto = contexto, .bloque = bloque};
+    struct trabajador_s trabajadores[PARALELO_HILOS_MAX];
+    pthread_t hilos[PARALELO_HILOS_MAX];
+
+    // El grupo permanente atiende una llamada a la vez; las llamadas simultáneas o anidadas usan hilos propios
+    bool grupo = (pthread_mutex_trylock(&grupo_uso) == 0);
+    if (grupo) {
+        AgrandarGrupo(hilos_disponibles - 1);
+    }
+
+    for (size_t base = 0; base < cantidad; base += trabajo.cantidad) {
+        size_t bloques = (cantidad - base + bloque - 1) / bloque;
+        if (bloques > BLOQUES_MAX) {
+            bloques = BLOQUES_MAX;
+        }
+        trabajo.base = base;
+        trabajo.cantidad = (bloques * bloque < cantidad - base) ? bloques * bloque : cantidad - base;
+        trabajo.hilos = (bloques < hilos_disponibles) ? bloques : hilos_disponibles;
+
+        for (size_t i = 0; i < trabajo.hilos; i++) {
+            size_t inicio = bloques * i / trabajo.hilos;
+            size_t fin = bloques * (i + 1) / trabajo.hilos;
+            atomic_init(&trabajo.porciones[i].rango, RANGO(inicio, fin));
+            trabajadores[i].trabajo = &trabajo;
+            trabajadores[i].indice = i;
+        }
+
+        // Las porciones de los hilos que faltan quedan disponibles para ser robadas
+        if (grupo) {
+            pthread_mutex_lock(&grupo_cerrojo);
+            grupo_trabajo = &trabajo;
+            grupo_participantes = (trabajo.hilos < grupo_hilos + 1) ? trabajo.hilos : grupo_hilos + 1;
+            grupo_pendientes = grupo_participantes - 1;
+            grupo_ronda++;
+            pthread_cond_broadcast(&grupo_aviso);
+            pthread_mutex_unlock(&grupo_cerrojo);
+
+            Trabajar(&trabajadores[0]);
+
+            pthread_mutex_lock(&grupo_cerrojo);
+            while (grupo_pendientes > 0) {
+                pthread_cond_wait(&grupo_fin, &grupo_cerrojo);
+            }
+            pthread_mutex_unlock(&grupo_cerrojo);
+        } else {
+            size_t creados = 1;
+            while ((creados < trabajo.hilos) &&
+                   (pthread_create(&hilos[creados], NULL, Trabajar, &trabajadores[creados]) == 0)) {
+                creados++;
+            }
+
+            Trabajar(&trabajadores[0]);
+            for (size_t i = 1; i < creados; i++) {
+                pthread_join(hilos[i], NULL);
+            }
+        }
+    }
+
+    if (grupo) {
+        pthread_mutex_unlock(&grupo_uso);
+    }
+}
+
+void ParaleloLimitarHilos(size_t hilos) {
+    atomic_store(&hilos_limite, hilos);
+}
+
+size_t ParaleloHilos(void) {
+    long procesadores = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t hilos = (procesadores > 0) ? (size_t)procesadores : 1;
+    size_t limite = atomic_load(&hilos_limite);
+
+    if ((limite > 0) && (hilos > limite)) {
+        hilos = limite;
+    }
+    if (hilos > PARALELO_HILOS_MAX) {
+        hilos = PARALELO_HILOS_MAX;
+    }
+    return hilos;
+}
+
+/* === End of documentation ======================================================================================== */
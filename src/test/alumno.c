@@ -0,0 +1,540 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file alumno.c
+ ** @brief prueba de la serialización de alumnos en JSON y de su lectura, de a uno y en lotes
+ **
+ ** Cada alumno de prueba se serializa, se compara con el texto esperado y se vuelve a leer, también cortado en cada
+ ** uno de sus caracteres y con caracteres de más, que no deben aceptarse. Se prueban los escapes de JSON, incluidos
+ ** los "\u" que se guardan en UTF-8, y los nombres del largo máximo con todos sus caracteres escapados. Los lotes se
+ ** leen desde archivos y desde tuberías alimentadas de a pocos caracteres, y se ubican alumnos sobre el límite entre
+ ** dos tramos leídos, de modo que el límite caiga en cada uno de sus caracteres. Después de cada lectura rechazada no
+ ** deben quedar alumnos ni textos creados.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "alumno.h"
+#include "textos.h"
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TRAMO (1 << 20) //!< bytes que AlumnoDeserializarLote lee de una vez, para ubicar alumnos sobre el límite
+
+#define SERIALIZADO_MAX (2 * 6 * ALUMNO_LARGO_MAX + 64) //!< largo máximo de un alumno serializado, todo escapado
+
+#define ARCHIVO_MAX (TRAMO + 2 * SERIALIZADO_MAX) //!< largo máximo de los arreglos JSON de la prueba
+
+#define CANTIDAD (sizeof(datos) / sizeof(datos[0])) //!< cantidad de alumnos de prueba
+
+//! Alumno válido para armar arreglos JSON de prueba
+#define ELEMENTO "{\"nombre\":\"a\",\"apellido\":\"b\",\"documento\":\"1\"}"
+
+/* === Private data type declarations ============================================================================== */
+
+//! Datos de un alumno de prueba y el texto que debe generar al serializarlo
+struct datos_s {
+    const char * nombre;      //!< nombre del alumno
+    const char * apellido;    //!< apellido del alumno
+    uint32_t documento;       //!< documento del alumno
+    const char * serializado; //!< texto que genera AlumnoSerializar, o NULL si no se compara
+};
+
+//! Texto que un hilo escribe en una tubería mientras se lee del otro extremo
+struct tuberia_s {
+    int descriptor;     //!< extremo de escritura de la tubería, que se cierra al terminar
+    const char * texto; //!< caracteres a escribir
+    size_t largo;       //!< cantidad de caracteres a escribir
+    size_t pedazo;      //!< cantidad de caracteres de cada llamada a write
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Comprueba que un alumno tenga los datos esperados.
+ *
+ * @param alumno Alumno a comprobar, que puede ser NULL.
+ * @param esperado Datos esperados.
+ * @return true si el alumno existe y coincide.
+ */
+static bool Comprobar(alumno_t alumno, const struct datos_s * esperado);
+
+/**
+ * @brief Comprueba que un texto no se acepte como alumno.
+ *
+ * @param texto Caracteres a leer.
+ * @param largo Cantidad de caracteres a leer.
+ * @return true si AlumnoDeserializar rechazó el texto.
+ */
+static bool Rechazar(const char texto[], size_t largo);
+
+/**
+ * @brief Comprueba que no queden textos guardados, es decir que se destruyeron todos los alumnos creados.
+ *
+ * @param prueba Nombre de la prueba, para el mensaje de error.
+ * @return true si no quedan textos.
+ */
+static bool Liberados(const char * prueba);
+
+/**
+ * @brief Escribe en una tubería de a pedazos y la cierra al terminar.
+ *
+ * @param argumento Referencia a la descripción de la tubería, struct tuberia_s.
+ * @return Siempre NULL.
+ */
+static void * Alimentar(void * argumento);
+
+/**
+ * @brief Lee un lote de alumnos desde un archivo temporal o una tubería con el texto indicado.
+ *
+ * @param texto Contenido del archivo o la tubería.
+ * @param largo Cantidad de caracteres del contenido.
+ * @param pedazo Si es 0 se lee desde un archivo, sino desde una tubería donde se escriben pedazos de este largo.
+ * @param alumnos Arreglo donde se guardan los alumnos leídos.
+ * @param capacidad Cantidad de referencias que entran en el arreglo.
+ * @return Resultado de AlumnoDeserializarLote, o -1 si no se pudo preparar el archivo o la tubería.
+ */
+static int Cargar(const char texto[], size_t largo, size_t pedazo, alumno_t alumnos[], size_t capacidad);
+
+/**
+ * @brief Prueba que cada alumno de prueba se serialice como se espera y se lea igual al original.
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarIdaYVuelta(void);
+
+/**
+ * @brief Prueba la lectura de escapes de JSON que AlumnoSerializar no genera y el rechazo de textos inválidos.
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarEscapes(void);
+
+/**
+ * @brief Prueba nombres del largo máximo, con todos sus caracteres escapados o de dos bytes en UTF-8.
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarLargoMaximo(void);
+
+/**
+ * @brief Prueba que un lote escrito con AlumnoSerializarLote se lea completo desde archivos y tuberías.
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarLote(void);
+
+/**
+ * @brief Prueba lotes con alumnos ubicados sobre el límite entre el primer y el segundo tramo leídos.
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarLimiteDeTramo(void);
+
+/**
+ * @brief Prueba que los arreglos mal formados o con más alumnos que la capacidad se rechacen sin dejar alumnos.
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarLotesInvalidos(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Alumnos de prueba, con caracteres que se escriben sin escapar, con escapes de una letra y con escapes "\u"
+static const struct datos_s datos[] = {
+    {"Jesús Alejandro", "Roldán", 12345678,
+     "{\"nombre\":\"Jesús Alejandro\",\"apellido\":\"Roldán\",\"documento\":\"12345678\"}"},
+    {"O\"Neill \\ barra/", "línea\nnueva\ttab\r\b\f", 1,
+     "{\"nombre\":\"O\\\"Neill \\\\ barra/\",\"apellido\":\"línea\\nnueva\\ttab\\r\\b\\f\",\"documento\":\"1\"}"},
+    {"\x01 control \x1f", "", UINT32_MAX,
+     "{\"nombre\":\"\\u0001 control \\u001f\",\"apellido\":\"\",\"documento\":\"4294967295\"}"},
+};
+
+static char nombre_largo[ALUMNO_LARGO_MAX + 1]; //!< nombre del largo máximo con todos los caracteres ASCII
+
+static char apellido_largo[ALUMNO_LARGO_MAX + 1]; //!< apellido del largo máximo hecho de letras de dos bytes
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+bool Comprobar(alumno_t alumno, const struct datos_s * esperado) {
+    if ((alumno == NULL) || (strcmp(AlumnoNombre(alumno), esperado->nombre) != 0) ||
+        (strcmp(AlumnoApellido(alumno), esperado->apellido) != 0) ||
+        (AlumnoDocumento(alumno) != esperado->documento)) {
+        printf("alumno distinto de \"%.40s\" \"%.40s\" %u\n", esperado->nombre, esperado->apellido,
+               (unsigned)esperado->documento);
+        return false;
+    }
+    return true;
+}
+
+bool Rechazar(const char texto[], size_t largo) {
+    alumno_t alumno = AlumnoDeserializar(texto, (uint32_t)largo);
+
+    if (alumno != NULL) {
+        printf("se aceptó como alumno el texto \"%.*s\"\n", (int)((largo < 80) ? largo : 80), texto);
+        AlumnoDestruir(alumno);
+        return false;
+    }
+    return true;
+}
+
+bool Liberados(const char * prueba) {
+    size_t cantidad;
+
+    if ((TextosMemoria(&cantidad) != 0) || (cantidad != 0)) {
+        printf("%s: quedaron %zu textos sin liberar\n", prueba, cantidad);
+        return false;
+    }
+    return true;
+}
+
+void * Alimentar(void * argumento) {
+    struct tuberia_s * tuberia = argumento;
+
+    for (size_t escritos = 0; escritos < tuberia->largo;) {
+        size_t pedazo = tuberia->largo - escritos;
+        if (pedazo > tuberia->pedazo) {
+            pedazo = tuberia->pedazo;
+        }
+        ssize_t resultado = write(tuberia->descriptor, tuberia->texto + escritos, pedazo);
+        if (resultado <= 0) {
+            break;
+        }
+        escritos += (size_t)resultado;
+    }
+    close(tuberia->descriptor);
+    return NULL;
+}
+
+int Cargar(const char texto[], size_t largo, size_t pedazo, alumno_t alumnos[], size_t capacidad) {
+    int resultado = -1;
+
+    if (pedazo == 0) {
+        FILE * archivo = tmpfile();
+        if (archivo == NULL) {
+            return -1;
+        }
+        if ((fwrite(texto, 1, largo, archivo) == largo) && (fflush(archivo) == 0) &&
+            (lseek(fileno(archivo), 0, SEEK_SET) == 0)) {
+            resultado = AlumnoDeserializarLote(fileno(archivo), alumnos, capacidad);
+        }
+        fclose(archivo);
+        return resultado;
+    }
+
+    struct tuberia_s tuberia = {.texto = texto, .largo = largo, .pedazo = pedazo};
+    int extremos[2];
+    pthread_t hilo;
+    if (pipe(extremos) != 0) {
+        return -1;
+    }
+    tuberia.descriptor = extremos[1];
+    if (pthread_create(&hilo, NULL, Alimentar, &tuberia) != 0) {
+        close(extremos[0]);
+        close(extremos[1]);
+        return -1;
+    }
+    resultado = AlumnoDeserializarLote(extremos[0], alumnos, capacidad);
+    // Si la lectura terminó antes de tiempo, cerrar la tubería hace que el hilo deje de escribir
+    close(extremos[0]);
+    pthread_join(hilo, NULL);
+    return resultado;
+}
+
+bool ProbarIdaYVuelta(void) {
+    static char buffer[SERIALIZADO_MAX];
+    bool correcto = true;
+
+    for (size_t i = 0; correcto && (i < CANTIDAD); i++) {
+        alumno_t original = AlumnoCrear((char *)datos[i].nombre, (char *)datos[i].apellido, datos[i].documento);
+        int largo = (original != NULL) ? AlumnoSerializar(original, buffer, sizeof(buffer)) : -1;
+
+        if ((largo < 0) || (strcmp(buffer, datos[i].serializado) != 0) ||
+            ((size_t)largo != AlumnoTamanoSerializado(original))) {
+            printf("el alumno %zu no se serializó como \"%.60s\"\n", i, datos[i].serializado);
+            correcto = false;
+        }
+        // Sin lugar para el '\0' no se serializa
+        if (correcto && (AlumnoSerializar(original, buffer, (uint32_t)largo) != -1)) {
+            printf("el alumno %zu se serializó sin lugar para el '\\0'\n", i);
+            correcto = false;
+        }
+
+        // El texto se acepta terminado en '\0' o justo en su último carácter, pero no cortado ni seguido de otro
+        alumno_t copia = correcto ? AlumnoDeserializar(buffer, sizeof(buffer)) : NULL;
+        correcto = correcto && Comprobar(copia, &datos[i]);
+        AlumnoDestruir(copia);
+        copia = correcto ? AlumnoDeserializar(buffer, (uint32_t)largo) : NULL;
+        correcto = correcto && Comprobar(copia, &datos[i]);
+        AlumnoDestruir(copia);
+        for (int j = 0; correcto && (j < largo); j++) {
+            correcto = Rechazar(buffer, (size_t)j);
+        }
+        if (correcto) {
+            buffer[largo] = ' ';
+            correcto = Rechazar(buffer, (size_t)largo + 1);
+        }
+        AlumnoDestruir(original);
+    }
+    return Liberados("ida y vuelta") && correcto;
+}
+
+bool ProbarEscapes(void) {
+    static const char aceptado[] =
+        "{\"nombre\":\"\\u00d1and\\u00FA \\/ \\u20ac\",\"apellido\":\"A\\u0042\\\"\",\"documento\":\"0\"}";
+    static const struct datos_s esperado = {"Ñandú / €", "AB\"", 0, NULL};
+    static const char * const invalidos[] = {
+        "{\"nombre\":\"a\\x\",\"apellido\":\"b\",\"documento\":\"1\"}",
+        "{\"nombre\":\"\\u00g1\",\"apellido\":\"b\",\"documento\":\"1\"}",
+        "{\"nombre\":\"\\u0000\",\"apellido\":\"b\",\"documento\":\"1\"}",
+        "{\"nombre\":\"\\ud83d\\ude00\",\"apellido\":\"b\",\"documento\":\"1\"}",
+        "{\"nombre\":\"a\nb\",\"apellido\":\"b\",\"documento\":\"1\"}",
+        "{\"nombre\":\"a\",\"apellido\":\"b\",\"documento\":\"4294967296\"}",
+        "{\"nombre\":\"a\",\"apellido\":\"b\",\"documento\":\"\"}",
+        "{\"nombre\":\"a\",\"apellido\":\"b\",\"documento\":\"1a\"}",
+        "{\"nombre\":\"a\",\"apellido\":\"b\",\"documento\":1}",
+        "{\"apellido\":\"b\",\"nombre\":\"a\",\"documento\":\"1\"}",
+        "{\"nombre\":\"a\",\"apellido\":\"b\",\"documento\":\"1\"}x",
+        " {\"nombre\":\"a\",\"apellido\":\"b\",\"documento\":\"1\"}",
+        "{\"nombre\":\"a\",\"apellido\":\"b\"}",
+    };
+
+    alumno_t alumno = AlumnoDeserializar(aceptado, sizeof(aceptado));
+    bool correcto = Comprobar(alumno, &esperado);
+    AlumnoDestruir(alumno);
+
+    for (size_t i = 0; i < sizeof(invalidos) / sizeof(invalidos[0]); i++) {
+        correcto = Rechazar(invalidos[i], strlen(invalidos[i]) + 1) && correcto;
+    }
+    return Liberados("escapes") && correcto;
+}
+
+bool ProbarLargoMaximo(void) {
+    static char buffer[SERIALIZADO_MAX];
+    static char nombre[ALUMNO_LARGO_MAX + 2];
+    struct datos_s largo = {nombre_largo, apellido_largo, 4000000000u, NULL};
+    bool correcto = true;
+
+    alumno_t original = AlumnoCrear(nombre_largo, apellido_largo, largo.documento);
+    int caracteres = (original != NULL) ? AlumnoSerializar(original, buffer, sizeof(buffer)) : -1;
+    if ((caracteres < 0) || ((size_t)caracteres != AlumnoTamanoSerializado(original))) {
+        printf("no se serializó el alumno del largo máximo\n");
+        correcto = false;
+    }
+    alumno_t copia = correcto ? AlumnoDeserializar(buffer, sizeof(buffer)) : NULL;
+    correcto = correcto && Comprobar(copia, &largo);
+    AlumnoDestruir(copia);
+    AlumnoDestruir(original);
+
+    // Un "\u" que pasa de un byte a dos en UTF-8 puede dejar el nombre un carácter más largo que el máximo
+    memset(nombre, 'a', ALUMNO_LARGO_MAX - 2);
+    strcpy(nombre + ALUMNO_LARGO_MAX - 2, "ñ");
+    largo = (struct datos_s){nombre, "", 1, NULL};
+    snprintf(buffer, sizeof(buffer), "{\"nombre\":\"%.*s\\u00f1\",\"apellido\":\"\",\"documento\":\"1\"}",
+             ALUMNO_LARGO_MAX - 2, nombre);
+    copia = AlumnoDeserializar(buffer, sizeof(buffer));
+    correcto = Comprobar(copia, &largo) && correcto;
+    AlumnoDestruir(copia);
+
+    memset(nombre, 'a', ALUMNO_LARGO_MAX + 1);
+    snprintf(buffer, sizeof(buffer), "{\"nombre\":\"%.*s\\u00f1\",\"apellido\":\"\",\"documento\":\"1\"}",
+             ALUMNO_LARGO_MAX - 1, nombre);
+    correcto = Rechazar(buffer, sizeof(buffer)) && correcto;
+    snprintf(buffer, sizeof(buffer), "{\"nombre\":\"%.*s\",\"apellido\":\"\",\"documento\":\"1\"}",
+             ALUMNO_LARGO_MAX + 1, nombre);
+    correcto = Rechazar(buffer, sizeof(buffer)) && correcto;
+    return Liberados("largo máximo") && correcto;
+}
+
+bool ProbarLote(void) {
+    char esperado[512];
+    char leido[512];
+    alumno_t alumnos[2];
+    bool correcto = true;
+
+    // Con memoria estática puede haber solo dos alumnos a la vez, así que el lote es de dos
+    int largo = snprintf(esperado, sizeof(esperado), "[%s,%s]", datos[0].serializado, datos[1].serializado);
+    for (size_t i = 0; i < 2; i++) {
+        alumnos[i] = AlumnoCrear((char *)datos[i].nombre, (char *)datos[i].apellido, datos[i].documento);
+    }
+    FILE * archivo = tmpfile();
+    ssize_t escritos = -1;
+    if ((archivo != NULL) && (AlumnoSerializarLote(alumnos, 2, fileno(archivo)) == 0) &&
+        (lseek(fileno(archivo), 0, SEEK_SET) == 0)) {
+        escritos = read(fileno(archivo), leido, sizeof(leido));
+    }
+    if ((escritos != largo) || (memcmp(leido, esperado, (size_t)largo) != 0)) {
+        printf("el lote no se escribió como \"%.60s\"\n", esperado);
+        correcto = false;
+    }
+    if (archivo != NULL) {
+        fclose(archivo);
+    }
+    AlumnoDestruir(alumnos[0]);
+    AlumnoDestruir(alumnos[1]);
+
+    // Las tuberías alimentadas de a pocos caracteres cortan a los alumnos en cualquier lugar
+    static const size_t pedazos[] = {0, 1, 7, 4096};
+    for (size_t i = 0; correcto && (i < sizeof(pedazos) / sizeof(pedazos[0])); i++) {
+        int cantidad = Cargar(esperado, (size_t)largo, pedazos[i], alumnos, 2);
+        correcto = (cantidad == 2) && Comprobar(alumnos[0], &datos[0]) && Comprobar(alumnos[1], &datos[1]);
+        if (cantidad == 2) {
+            AlumnoDestruir(alumnos[0]);
+            AlumnoDestruir(alumnos[1]);
+        }
+    }
+    for (int j = 0; correcto && (j < largo); j++) {
+        correcto = (Cargar(esperado, (size_t)j, 0, alumnos, 2) == -1);
+    }
+    correcto = correcto && (Cargar(esperado, (size_t)largo, 0, alumnos, 1) == -1);
+    correcto = correcto && (Cargar(" [ \n ] \n", 8, 0, alumnos, 2) == 0);
+    if (!correcto) {
+        printf("no se leyó correctamente el lote \"%.60s\"\n", esperado);
+    }
+    return Liberados("lote") && correcto;
+}
+
+bool ProbarLimiteDeTramo(void) {
+    static char archivo[ARCHIVO_MAX];
+    static char elementos[2 * SERIALIZADO_MAX + 2];
+    struct datos_s largo = {nombre_largo, apellido_largo, 4000000000u, NULL};
+    alumno_t alumnos[2];
+    bool correcto = true;
+
+    memset(archivo, ' ', sizeof(archivo));
+    archivo[0] = '[';
+
+    // Los dos alumnos empiezan cada vez un carácter antes del final del primer tramo, de modo que el límite cae en
+    // cada uno de sus caracteres, en la coma que los separa y por último en el corchete que cierra el arreglo
+    size_t cantidad_elementos = (size_t)snprintf(elementos, sizeof(elementos), "%s,\n%s", datos[1].serializado,
+                                                 datos[2].serializado);
+    for (size_t atras = 1; correcto && (atras <= cantidad_elementos + 1); atras++) {
+        size_t inicio = TRAMO - atras;
+        memcpy(archivo + inicio, elementos, cantidad_elementos);
+        archivo[inicio + cantidad_elementos] = ']';
+
+        int cantidad = Cargar(archivo, inicio + cantidad_elementos + 1, 0, alumnos, 2);
+        correcto = (cantidad == 2) && Comprobar(alumnos[0], &datos[1]) && Comprobar(alumnos[1], &datos[2]);
+        if (!correcto) {
+            printf("no se leyeron los alumnos que empiezan %zu caracteres antes del límite\n", atras);
+        }
+        for (int i = 0; i < cantidad; i++) {
+            AlumnoDestruir(alumnos[i]);
+        }
+        memset(archivo + inicio, ' ', cantidad_elementos + 1);
+    }
+
+    // Un alumno del largo máximo, con casi todos sus caracteres escapados, cortado en distintos lugares
+    alumno_t original = AlumnoCrear(nombre_largo, apellido_largo, largo.documento);
+    int caracteres = (original != NULL) ? AlumnoSerializar(original, elementos, sizeof(elementos)) : -1;
+    AlumnoDestruir(original);
+    correcto = correcto && (caracteres > 0);
+    size_t atrases[] = {1, 2, 5, 6, 7, (size_t)caracteres / 2, (size_t)caracteres - 1, (size_t)caracteres};
+    for (size_t i = 0; correcto && (i < sizeof(atrases) / sizeof(atrases[0])); i++) {
+        size_t inicio = TRAMO - atrases[i];
+        memcpy(archivo + inicio, elementos, (size_t)caracteres);
+        archivo[inicio + (size_t)caracteres] = ']';
+
+        // El último caso se lee desde una tubería, que entrega el archivo en pedazos de otro tamaño
+        size_t pedazo = (i + 1 < sizeof(atrases) / sizeof(atrases[0])) ? 0 : 65536;
+        int cantidad = Cargar(archivo, inicio + (size_t)caracteres + 1, pedazo, alumnos, 1);
+        correcto = (cantidad == 1) && Comprobar(alumnos[0], &largo);
+        if (!correcto) {
+            printf("no se leyó el alumno del largo máximo que empieza %zu caracteres antes del límite\n", atrases[i]);
+        }
+        if (cantidad == 1) {
+            AlumnoDestruir(alumnos[0]);
+        }
+        memset(archivo + inicio, ' ', (size_t)caracteres + 1);
+    }
+    return Liberados("límite de tramo") && correcto;
+}
+
+bool ProbarLotesInvalidos(void) {
+    static const char * const invalidos[] = {
+        "",
+        "[",
+        "]",
+        "[,]",
+        ELEMENTO,
+        "[" ELEMENTO ",]",
+        "[," ELEMENTO "]",
+        "[" ELEMENTO ELEMENTO "]",
+        "[" ELEMENTO "]]",
+        "[" ELEMENTO "] x",
+        "[" ELEMENTO "," ELEMENTO "," ELEMENTO "]",
+        "[" ELEMENTO ",{\"nombre\":\"a\",\"apellido\":\"b\\q\",\"documento\":\"1\"}]",
+    };
+    alumno_t alumnos[2];
+    bool correcto = true;
+
+    for (size_t i = 0; i < sizeof(invalidos) / sizeof(invalidos[0]); i++) {
+        for (size_t pedazo = 0; pedazo < 2; pedazo++) {
+            if (Cargar(invalidos[i], strlen(invalidos[i]), pedazo, alumnos, 2) != -1) {
+                printf("se aceptó el lote \"%.60s\"\n", invalidos[i]);
+                correcto = false;
+            }
+        }
+    }
+    return Liberados("lotes inválidos") && correcto;
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Ejecuta las pruebas de serialización de alumnos.
+ *
+ * @return 0 si todas las pruebas pasaron, 1 en otro caso.
+ */
+
+int main(void) {
+    // Las lecturas rechazadas cierran las tuberías mientras el hilo que las alimenta todavía puede estar escribiendo
+    signal(SIGPIPE, SIG_IGN);
+
+    // El nombre largo recorre todos los caracteres ASCII salvo el '\0', así que usa todas las formas de escape
+    for (size_t i = 0; i < ALUMNO_LARGO_MAX; i++) {
+        nombre_largo[i] = (char)(1 + i % 127);
+    }
+    for (size_t i = 0; i + 1 < ALUMNO_LARGO_MAX; i += 2) {
+        memcpy(apellido_largo + i, "ñ", 2);
+    }
+
+    bool correcto = ProbarIdaYVuelta();
+    correcto = ProbarEscapes() && correcto;
+    correcto = ProbarLargoMaximo() && correcto;
+    correcto = ProbarLote() && correcto;
+    correcto = ProbarLimiteDeTramo() && correcto;
+    correcto = ProbarLotesInvalidos() && correcto;
+
+    printf("alumno: %s\n", correcto ? "correcto" : "incorrecto");
+    return correcto ? 0 : 1;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,255 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file binario.c
+ ** @brief prueba de la escritura y la lectura de archivos binarios de alumnos
+ **
+ ** Se escribe un archivo con y sin índice de documentos y se comprueba que al abrirlo cada registro tenga los datos
+ ** y los textos del alumno que lo generó, y que la búsqueda por documento entregue la primera fila con ese
+ ** documento. Después se prueba que no se abran los archivos cortados en cualquier lugar ni los que tienen otra
+ ** firma, y que un texto dañado se informe vacío sin afectar a los demás registros.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "binario.h"
+#include "textos.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define FILAS 1000 //!< registros del archivo de prueba, que repiten los alumnos de prueba
+
+#define CANTIDAD (sizeof(datos) / sizeof(datos[0])) //!< cantidad de alumnos de prueba
+
+#define CONTENIDO_MAX 1024 //!< bytes que alcanzan para un archivo con un registro por alumno de prueba
+
+/* === Private data type declarations ============================================================================== */
+
+//! Datos de un alumno de prueba
+struct datos_s {
+    const char * nombre;   //!< nombre del alumno
+    const char * apellido; //!< apellido del alumno
+    uint32_t documento;    //!< documento del alumno
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Escribe un contenido en un archivo temporal y lo abre como archivo binario.
+ *
+ * @param contenido Bytes del archivo.
+ * @param largo Cantidad de bytes del archivo.
+ * @return Resultado de BinarioAbrir, o NULL si no se pudo crear el archivo temporal.
+ */
+static binario_t Abrir(const char contenido[], size_t largo);
+
+/**
+ * @brief Comprueba que una fila de un archivo abierto tenga los datos de un alumno de prueba.
+ *
+ * @param binario Archivo abierto.
+ * @param fila Fila a comprobar.
+ * @param esperado Datos esperados.
+ * @return true si la fila coincide.
+ */
+static bool Comprobar(binario_t binario, size_t fila, const struct datos_s * esperado);
+
+/**
+ * @brief Prueba que un archivo escrito se lea igual, con y sin índice de documentos.
+ *
+ * @param alumnos Alumnos de prueba, en el orden de datos.
+ * @return true si la prueba pasó.
+ */
+static bool ProbarIdaYVuelta(alumno_t alumnos[]);
+
+/**
+ * @brief Prueba que no se abran archivos cortados o de otra firma y que los textos dañados se informen vacíos.
+ *
+ * @param alumnos Alumnos de prueba, en el orden de datos.
+ * @return true si la prueba pasó.
+ */
+static bool ProbarDanados(alumno_t alumnos[]);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Alumnos de prueba; con memoria estática puede haber solo dos a la vez
+static const struct datos_s datos[] = {
+    {"Ana María", "Pérez", 30},
+    {"", "O'Brien, \"el\" grande", 10},
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+binario_t Abrir(const char contenido[], size_t largo) {
+    binario_t binario = NULL;
+    FILE * archivo = tmpfile();
+
+    if (archivo == NULL) {
+        return NULL;
+    }
+    if ((fwrite(contenido, 1, largo, archivo) == largo) && (fflush(archivo) == 0)) {
+        binario = BinarioAbrir(fileno(archivo));
+    }
+    // El archivo sigue proyectado después de cerrar el descriptor
+    fclose(archivo);
+    return binario;
+}
+
+bool Comprobar(binario_t binario, size_t fila, const struct datos_s * esperado) {
+    const binario_registro_t * registro = &BinarioRegistros(binario)[fila];
+
+    if ((registro->documento != esperado->documento) || (strcmp(BinarioNombre(binario, fila), esperado->nombre) != 0) ||
+        (strcmp(BinarioApellido(binario, fila), esperado->apellido) != 0) ||
+        (registro->largo_nombre != strlen(esperado->nombre)) ||
+        (registro->largo_apellido != strlen(esperado->apellido))) {
+        printf("la fila %zu es distinta de \"%s\" \"%s\" %u\n", fila, esperado->nombre, esperado->apellido,
+               (unsigned)esperado->documento);
+        return false;
+    }
+    return true;
+}
+
+bool ProbarIdaYVuelta(alumno_t alumnos[]) {
+    static alumno_t filas[FILAS];
+    bool correcto = true;
+
+    for (size_t i = 0; i < FILAS; i++) {
+        filas[i] = alumnos[i % CANTIDAD];
+    }
+    for (int indexar = 0; correcto && (indexar < 2); indexar++) {
+        FILE * archivo = tmpfile();
+        binario_t binario = NULL;
+
+        if ((archivo != NULL) && (BinarioEscribir(filas, FILAS, indexar, fileno(archivo)) == 0)) {
+            binario = BinarioAbrir(fileno(archivo));
+        }
+        if (archivo != NULL) {
+            fclose(archivo);
+        }
+        if ((binario == NULL) || (BinarioCantidad(binario) != FILAS)) {
+            printf("no se pudo abrir el archivo escrito %s índice\n", indexar ? "con" : "sin");
+            BinarioCerrar(binario);
+            return false;
+        }
+        for (size_t fila = 0; correcto && (fila < FILAS); fila++) {
+            correcto = Comprobar(binario, fila, &datos[fila % CANTIDAD]);
+        }
+        for (size_t i = 0; correcto && (i < CANTIDAD); i++) {
+            correcto = (BinarioBuscarPorDocumento(binario, datos[i].documento) == i);
+        }
+        correcto = correcto && (BinarioBuscarPorDocumento(binario, 20) == BINARIO_NINGUNO) &&
+                   (BinarioBuscarPorDocumento(binario, 0) == BINARIO_NINGUNO) &&
+                   (BinarioBuscarPorDocumento(binario, UINT32_MAX) == BINARIO_NINGUNO);
+        if (!correcto) {
+            printf("falló la lectura del archivo %s índice\n", indexar ? "con" : "sin");
+        }
+        BinarioCerrar(binario);
+    }
+    return correcto;
+}
+
+bool ProbarDanados(alumno_t alumnos[]) {
+    char contenido[CONTENIDO_MAX];
+    ssize_t largo = -1;
+    bool correcto = true;
+
+    FILE * archivo = tmpfile();
+    if ((archivo != NULL) && (BinarioEscribir(alumnos, CANTIDAD, true, fileno(archivo)) == 0) &&
+        (lseek(fileno(archivo), 0, SEEK_SET) == 0)) {
+        largo = read(fileno(archivo), contenido, sizeof(contenido));
+    }
+    if (archivo != NULL) {
+        fclose(archivo);
+    }
+    if ((largo <= 0) || ((size_t)largo == sizeof(contenido))) {
+        printf("no se pudo escribir el archivo de prueba\n");
+        return false;
+    }
+
+    // Cortado en cualquier lugar, a alguna sección le faltan bytes
+    for (ssize_t i = 0; i < largo; i++) {
+        binario_t binario = Abrir(contenido, (size_t)i);
+        if (binario != NULL) {
+            printf("se abrió el archivo cortado en %zd bytes\n", i);
+            BinarioCerrar(binario);
+            correcto = false;
+        }
+    }
+
+    contenido[0] ^= 0x20;
+    binario_t binario = Abrir(contenido, (size_t)largo);
+    if (binario != NULL) {
+        printf("se abrió un archivo con otra firma\n");
+        BinarioCerrar(binario);
+        correcto = false;
+    }
+    contenido[0] ^= 0x20;
+
+    // El archivo termina con el '\0' del último apellido; sin él ese texto está dañado pero los demás no
+    contenido[largo - 1] = 'x';
+    binario = Abrir(contenido, (size_t)largo);
+    if ((binario == NULL) || !Comprobar(binario, 0, &datos[0]) || (strcmp(BinarioNombre(binario, 1), "") != 0) ||
+        (strcmp(BinarioApellido(binario, 1), "") != 0)) {
+        printf("no se informó vacío el apellido dañado\n");
+        correcto = false;
+    }
+    BinarioCerrar(binario);
+    return correcto;
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Ejecuta las pruebas de los archivos binarios de alumnos.
+ *
+ * @return 0 si todas las pruebas pasaron, 1 en otro caso.
+ */
+
+int main(void) {
+    alumno_t alumnos[CANTIDAD];
+    bool correcto = true;
+
+    for (size_t i = 0; i < CANTIDAD; i++) {
+        alumnos[i] = AlumnoCrear((char *)datos[i].nombre, (char *)datos[i].apellido, datos[i].documento);
+        correcto = correcto && (alumnos[i] != NULL);
+    }
+    correcto = correcto && ProbarIdaYVuelta(alumnos);
+    correcto = correcto && ProbarDanados(alumnos);
+    for (size_t i = 0; i < CANTIDAD; i++) {
+        AlumnoDestruir(alumnos[i]);
+    }
+
+    size_t cantidad;
+    if ((TextosMemoria(&cantidad) != 0) || (cantidad != 0)) {
+        printf("quedaron %zu textos sin liberar\n", cantidad);
+        correcto = false;
+    }
+
+    printf("binario: %s\n", correcto ? "correcto" : "incorrecto");
+    return correcto ? 0 : 1;
+}
+
+/* === End of documentation ======================================================================================== */
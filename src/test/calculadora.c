@@ -0,0 +1,268 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+
+/** @file calculadora.c
+ ** @brief prueba de la creación, destrucción y evaluación de calculadoras
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calculadora.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define ARENA_TAMANO (1u << 16) //!< bytes de la arena de las calculadoras creadas por la prueba
+#define ARENA_OPERADORES (1u << 14) //!< bytes de la arena en la que se registran todos los operadores posibles
+#define TERMINOS 3000 //!< cantidad de términos de las expresiones largas, que generan miles de instrucciones
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Comprueba que una calculadora evalúe una expresión con el resultado esperado.
+ *
+ * @param calculadora Calculadora a usar.
+ * @param expresion Expresión a evaluar.
+ * @param esperado Resultado esperado.
+ * @return true si la expresión se evaluó sin errores y dio el resultado esperado.
+ */
+static bool Comprobar(calculadora_t calculadora, const char * expresion, int esperado);
+
+/**
+ * @brief Comprueba que una calculadora rechace una expresión con el estado esperado.
+ *
+ * @param calculadora Calculadora a usar.
+ * @param expresion Expresión a evaluar.
+ * @param esperado Estado esperado.
+ * @return true si la evaluación terminó con el estado esperado.
+ */
+static bool ComprobarError(calculadora_t calculadora, const char * expresion, calculadora_estado_t esperado);
+
+/**
+ * @brief Escribe una expresión que repite un término unido por '+', con un prefijo y un final.
+ *
+ * @param prefijo Texto inicial de la expresión.
+ * @param termino Término que se repite TERMINOS veces.
+ * @param final Texto con el que termina la expresión.
+ * @return Expresión escrita en un arreglo estático.
+ */
+static const char * Repetir(const char * prefijo, const char * termino, const char * final);
+
+/**
+ * @brief Evalúa expresiones de miles de instrucciones y comprueba sus resultados y sus errores.
+ *
+ * @param calculadora Calculadora con las cuatro operaciones básicas registradas.
+ * @return true si todas las expresiones dieron el resultado o el error esperado.
+ */
+static bool EvaluarLargas(calculadora_t calculadora);
+
+/**
+ * @brief Prueba que las expresiones largas se evalúen también en calculadoras que no piden memoria.
+ *
+ * CalculadoraCalcula ejecuta las expresiones por tramos mientras las compila, así que su longitud no está limitada
+ * por la memoria de la calculadora ni cambia los errores que se informan.
+ *
+ * @return true si una calculadora en una arena y una de CalculadoraCrear evaluaron bien todas las expresiones.
+ */
+static bool ProbarExpresionesLargas(void);
+
+/**
+ * @brief Prueba que destruir una calculadora creada en una arena no libere la memoria de otra calculadora.
+ *
+ * Con memoria estática, las calculadoras de CalculadoraCrear ocupan un bloque propio; una calculadora creada en una
+ * arena provista por quien llama no ocupa ninguno y al destruirla no debe marcar como libre el de otra.
+ *
+ * @return true si la calculadora creada antes sigue funcionando y no se entrega otra vez.
+ */
+static bool ProbarArenaProvista(void);
+
+/**
+ * @brief Registra como operador cada carácter que no está reservado y comprueba que todos se puedan usar.
+ *
+ * @param calculadora Calculadora sin operaciones registradas.
+ * @return true si se registraron todos los caracteres y cada uno evalúa una expresión con su operación.
+ */
+static bool RegistrarTodos(calculadora_t calculadora);
+
+/**
+ * @brief Prueba que las calculadoras con memoria acotada admitan todos los operadores posibles.
+ *
+ * Registrar una operación no debe consumir una copia de la tabla de operaciones, de modo que una arena pequeña y el
+ * bloque de una calculadora con memoria estática alcanzan para registrar cada carácter que no está reservado.
+ *
+ * @return true si ambas calculadoras registraron y evaluaron todos los operadores.
+ */
+static bool ProbarTodosLosOperadores(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static _Alignas(max_align_t) unsigned char bloque[ARENA_TAMANO]; //!< memoria de la arena de la prueba
+
+static char larga[TERMINOS * 8 + 64]; //!< texto de las expresiones largas
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+bool Comprobar(calculadora_t calculadora, const char * expresion, int esperado) {
+    int resultado;
+    calculadora_estado_t estado = CalculadoraCalculaEstado(calculadora, expresion, strlen(expresion), &resultado);
+
+    if ((estado != CALCULADORA_CORRECTO) || (resultado != esperado)) {
+        printf("%.40s: estado %d, resultado %d, esperado %d\n", expresion, estado, resultado, esperado);
+        return false;
+    }
+    return true;
+}
+
+bool ComprobarError(calculadora_t calculadora, const char * expresion, calculadora_estado_t esperado) {
+    int resultado;
+    calculadora_estado_t estado = CalculadoraCalculaEstado(calculadora, expresion, strlen(expresion), &resultado);
+
+    if (estado != esperado) {
+        printf("%.40s...: estado %d, esperado %d\n", expresion, estado, esperado);
+        return false;
+    }
+    return true;
+}
+
+const char * Repetir(const char * prefijo, const char * termino, const char * final) {
+    size_t largo = strlen(prefijo);
+
+    memcpy(larga, prefijo, largo);
+    for (int i = 0; i < TERMINOS; i++) {
+        largo += (size_t)sprintf(&larga[largo], "%s%s", (i > 0) ? "+" : "", termino);
+    }
+    strcpy(&larga[largo], final);
+    return larga;
+}
+
+bool EvaluarLargas(calculadora_t calculadora) {
+    bool correcto = Comprobar(calculadora, Repetir("", "1", ""), TERMINOS);
+
+    correcto = Comprobar(calculadora, Repetir("-", "(2*3-5)", "*2"), TERMINOS - 1) && correcto;
+    correcto = Comprobar(calculadora, Repetir("((((", "1", "))))/3"), TERMINOS / 3) && correcto;
+    correcto = ComprobarError(calculadora, Repetir("1/0+", "1", ""), CALCULADORA_DIVISION_POR_CERO) && correcto;
+    correcto = ComprobarError(calculadora, Repetir("1/0+", "1", "+"), CALCULADORA_EXPRESION_INVALIDA) && correcto;
+    correcto = ComprobarError(calculadora, Repetir("1/0+", "1", "#1"), CALCULADORA_OPERADOR_DESCONOCIDO) && correcto;
+    correcto = ComprobarError(calculadora, Repetir("a+", "1", ""), CALCULADORA_EXPRESION_INVALIDA) && correcto;
+    return correcto;
+}
+
+bool ProbarExpresionesLargas(void) {
+    calculadora_t en_arena = CalculadoraCrearEnArena(ArenaCrear(bloque, sizeof(bloque)));
+    calculadora_t propia = CalculadoraCrear();
+    calculadora_t calculadoras[] = {en_arena, propia};
+    bool correcto = (en_arena != NULL) && (propia != NULL);
+
+    for (int i = 0; correcto && (i < 2); i++) {
+        correcto = CalculadoraAddOperacion(calculadoras[i], '+', OperacionAdd) &&
+                   CalculadoraAddOperacion(calculadoras[i], '-', OperacionSub) &&
+                   CalculadoraAddOperacion(calculadoras[i], '*', OperacionMul) &&
+                   CalculadoraAddOperacion(calculadoras[i], '/', OperacionDiv) && EvaluarLargas(calculadoras[i]);
+    }
+
+    CalculadoraDestruir(propia);
+    CalculadoraDestruir(en_arena);
+    return correcto;
+}
+
+bool ProbarArenaProvista(void) {
+    calculadora_t primera = CalculadoraCrear();
+    calculadora_t en_arena = CalculadoraCrearEnArena(ArenaCrear(bloque, sizeof(bloque)));
+    bool correcto = (primera != NULL) && (en_arena != NULL);
+
+    correcto = correcto && CalculadoraAddOperacion(primera, '+', OperacionAdd);
+    CalculadoraDestruir(en_arena);
+
+    calculadora_t segunda = CalculadoraCrear();
+    if (correcto && (segunda == primera)) {
+        printf("la calculadora creada antes se entregó otra vez\n");
+        correcto = false;
+    }
+    correcto = correcto && Comprobar(primera, "2+3", 5);
+
+    CalculadoraDestruir(segunda);
+    CalculadoraDestruir(primera);
+    return correcto;
+}
+
+bool RegistrarTodos(calculadora_t calculadora) {
+    int registrados = 0;
+    char expresion[] = "7?3";
+
+    for (int caracter = 1; caracter <= 255; caracter++) {
+        char operador = (char)caracter;
+        if ((operador == '(') || (operador == ')') || isdigit(caracter) || isspace(caracter)) {
+            continue;
+        }
+        if (!CalculadoraAddOperacion(calculadora, operador, (caracter % 2) ? OperacionAdd : OperacionMul)) {
+            printf("no se pudo registrar el operador %d después de %d\n", caracter, registrados);
+            return false;
+        }
+        registrados++;
+    }
+    for (int caracter = 1; caracter <= 255; caracter++) {
+        if ((caracter == '(') || (caracter == ')') || isdigit(caracter) || isspace(caracter) || isalpha(caracter)) {
+            continue;
+        }
+        expresion[1] = (char)caracter;
+        if (!Comprobar(calculadora, expresion, (caracter % 2) ? 10 : 21)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ProbarTodosLosOperadores(void) {
+    calculadora_t en_arena = CalculadoraCrearEnArena(ArenaCrear(bloque, ARENA_OPERADORES));
+    calculadora_t propia = CalculadoraCrear();
+    bool correcto = (en_arena != NULL) && (propia != NULL);
+
+    correcto = correcto && RegistrarTodos(en_arena) && RegistrarTodos(propia);
+
+    CalculadoraDestruir(propia);
+    CalculadoraDestruir(en_arena);
+    return correcto;
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Ejecuta las pruebas de las calculadoras.
+ *
+ * @return 0 si todas las pruebas pasaron, 1 en otro caso.
+ */
+
+int main(void) {
+    bool correcto = ProbarArenaProvista();
+    correcto = ProbarTodosLosOperadores() && correcto;
+    correcto = ProbarExpresionesLargas() && correcto;
+
+    printf("calculadoras: %s\n", correcto ? "correcto" : "incorrecto");
+    return correcto ? 0 : 1;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,243 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file concurrencia.c
+ ** @brief prueba de esfuerzo que evalúa expresiones desde varios hilos mientras otro registra operaciones
+ **
+ ** Los hilos evaluadores usan una misma calculadora con la memoria de resultados habilitada y más chica que la
+ ** cantidad de expresiones distintas, de modo que se consulta, se guarda y se reemplaza continuamente mientras el
+ ** registro de cada operación nueva la vacía. Cada resultado se compara con el esperado: una expresión con un
+ ** operador ya registrado al comenzar su evaluación debe dar el resultado de ese operador, y una con un operador
+ ** todavía no registrado solo puede dar ese resultado o CALCULADORA_OPERADOR_DESCONOCIDO.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calculadora.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define EVALUADORES 4 //!< hilos que evalúan expresiones una por una
+
+#define OPERADORES 128 //!< operadores que se registran durante la prueba
+
+#define PRIMER_OPERADOR 0x80 //!< carácter del primer operador registrado, fuera de los caracteres reservados
+
+#define MEMORIA 64 //!< capacidad de la memoria de resultados, menor que la cantidad de expresiones distintas
+
+#define LOTE 256 //!< expresiones de cada lote evaluado con CalculadoraCalculaLote
+
+#define VUELTAS_FINALES 20000 //!< evaluaciones de cada hilo después de registrar todas las operaciones
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Operación de prueba que devuelve el mayor de sus operandos.
+ */
+static int Maximo(int a, int b);
+
+/**
+ * @brief Operación de prueba que devuelve el menor de sus operandos.
+ */
+static int Minimo(int a, int b);
+
+/**
+ * @brief Escribe la expresión "a op b" con el operador de índice dado y calcula su resultado esperado.
+ *
+ * @param operador Índice del operador, de 0 a OPERADORES - 1.
+ * @param a Primer operando, de 0 a 9.
+ * @param b Segundo operando, de 0 a 9.
+ * @param texto Buffer de al menos cuatro caracteres donde se escribe la expresión terminada en '\0'.
+ * @return Resultado esperado de la expresión.
+ */
+static int Expresion(int operador, int a, int b, char texto[]);
+
+/**
+ * @brief Evalúa expresiones al azar de a una y comprueba sus resultados.
+ *
+ * @param argumento Semilla del generador de números al azar del hilo.
+ * @return NULL.
+ */
+static void * Evaluar(void * argumento);
+
+/**
+ * @brief Evalúa lotes de expresiones al azar y comprueba sus resultados.
+ *
+ * @param argumento Semilla del generador de números al azar del hilo.
+ * @return NULL.
+ */
+static void * EvaluarLotes(void * argumento);
+
+/**
+ * @brief Informa un resultado incorrecto y lo cuenta como falla.
+ *
+ * @param texto Expresión evaluada.
+ * @param estado Estado devuelto por la evaluación.
+ * @param obtenido Resultado obtenido.
+ * @param esperado Resultado esperado.
+ */
+static void Fallar(const char * texto, calculadora_estado_t estado, int obtenido, int esperado);
+
+/* === Private variable definitions ================================================================================ */
+
+static const operacion_func_t funciones[] = {Maximo, Minimo, OperacionAdd, OperacionSub}; //!< operaciones de prueba
+
+static calculadora_t calculadora; //!< calculadora compartida por todos los hilos
+
+static atomic_int registrados; //!< cantidad de operadores ya registrados
+
+static atomic_bool terminado; //!< indica que ya se registraron todos los operadores
+
+static atomic_int fallas; //!< cantidad de resultados incorrectos
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+int Maximo(int a, int b) {
+    return (a > b) ? a : b;
+}
+
+int Minimo(int a, int b) {
+    return (a < b) ? a : b;
+}
+
+int Expresion(int operador, int a, int b, char texto[]) {
+    texto[0] = (char)('0' + a);
+    texto[1] = (char)(PRIMER_OPERADOR + operador);
+    texto[2] = (char)('0' + b);
+    texto[3] = '\0';
+    return funciones[operador % 4](a, b);
+}
+
+void Fallar(const char * texto, calculadora_estado_t estado, int obtenido, int esperado) {
+    if (atomic_fetch_add(&fallas, 1) < 10) {
+        fprintf(stderr, "operador 0x%02X: estado %d, resultado %d, esperado %d\n", (unsigned char)texto[1], estado,
+                obtenido, esperado);
+    }
+}
+
+void * Evaluar(void * argumento) {
+    unsigned int semilla = (unsigned int)(size_t)argumento;
+    int vueltas = 0;
+
+    while (vueltas < VUELTAS_FINALES) {
+        if (atomic_load(&terminado)) {
+            vueltas++;
+        }
+
+        char texto[4];
+        int disponibles = atomic_load(&registrados);
+        int operador = rand_r(&semilla) % OPERADORES;
+        int esperado = Expresion(operador, rand_r(&semilla) % 10, rand_r(&semilla) % 10, texto);
+        int obtenido;
+        calculadora_estado_t estado = CalculadoraCalculaEstado(calculadora, texto, 3, &obtenido);
+
+        // Un operador que todavía no estaba registrado al comenzar puede no conocerse, pero nunca dar otro valor
+        bool desconocido = (operador >= disponibles) && (estado == CALCULADORA_OPERADOR_DESCONOCIDO);
+        if ((estado == CALCULADORA_CORRECTO) ? (obtenido != esperado) : !desconocido) {
+            Fallar(texto, estado, obtenido, esperado);
+        }
+    }
+    return NULL;
+}
+
+void * EvaluarLotes(void * argumento) {
+    unsigned int semilla = (unsigned int)(size_t)argumento;
+    static char textos[LOTE][4];
+    const char * expresiones[LOTE];
+    int operadores[LOTE];
+    int esperados[LOTE];
+    int resultados[LOTE];
+
+    do {
+        int disponibles = atomic_load(&registrados);
+        if (disponibles == 0) {
+            continue;
+        }
+
+        // Solo se usan operadores ya registrados, porque un lote no informa el estado de cada expresión
+        for (int i = 0; i < LOTE; i++) {
+            operadores[i] = rand_r(&semilla) % disponibles;
+            esperados[i] = Expresion(operadores[i], rand_r(&semilla) % 10, rand_r(&semilla) % 10, textos[i]);
+            expresiones[i] = textos[i];
+        }
+        CalculadoraCalculaLote(calculadora, expresiones, resultados, LOTE);
+        for (int i = 0; i < LOTE; i++) {
+            if (resultados[i] != esperados[i]) {
+                Fallar(textos[i], CALCULADORA_CORRECTO, resultados[i], esperados[i]);
+            }
+        }
+    } while (!atomic_load(&terminado));
+    return NULL;
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Registra operadores mientras otros hilos evalúan expresiones con la misma calculadora.
+ *
+ * @return 0 si todos los resultados fueron correctos, 1 en otro caso.
+ */
+
+int main(void) {
+    pthread_t hilos[EVALUADORES + 1];
+    uint64_t aciertos = 0;
+    uint64_t fallos = 0;
+
+    calculadora = CalculadoraCrear();
+    if (!calculadora || !CalculadoraCacheHabilitar(calculadora, MEMORIA)) {
+        return 1;
+    }
+
+    for (size_t i = 0; i < EVALUADORES; i++) {
+        pthread_create(&hilos[i], NULL, Evaluar, (void *)(i + 1));
+    }
+    pthread_create(&hilos[EVALUADORES], NULL, EvaluarLotes, (void *)(EVALUADORES + 1));
+
+    for (int i = 0; i < OPERADORES; i++) {
+        if (!CalculadoraAddOperacion(calculadora, (char)(PRIMER_OPERADOR + i), funciones[i % 4])) {
+            atomic_fetch_add(&fallas, 1);
+            break;
+        }
+        atomic_store(&registrados, i + 1);
+    }
+    atomic_store(&terminado, true);
+
+    for (size_t i = 0; i < EVALUADORES + 1; i++) {
+        pthread_join(hilos[i], NULL);
+    }
+
+    CalculadoraCacheEstadisticas(calculadora, &aciertos, &fallos);
+    CalculadoraDestruir(calculadora);
+    printf("operadores registrados: %d, aciertos: %llu, fallos: %llu, resultados incorrectos: %d\n",
+           atomic_load(&registrados), (unsigned long long)aciertos, (unsigned long long)fallos, atomic_load(&fallas));
+    return (atomic_load(&fallas) == 0) ? 0 : 1;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,344 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file csv.c
+ ** @brief prueba de la escritura y la lectura de alumnos en archivos CSV
+ **
+ ** Se escriben alumnos con comas, comillas y saltos de línea en sus nombres, se compara el archivo con el texto
+ ** esperado y se vuelve a leer desde un archivo, que se proyecta en memoria, y desde tuberías alimentadas de a pocos
+ ** caracteres, que cortan las filas en cualquier lugar. También se prueban las variantes de fin de línea que se
+ ** aceptan al leer, las filas del largo máximo y el rechazo de filas mal formadas sin dejar alumnos creados.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "csv.h"
+#include "textos.h"
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define CONTENIDO_MAX (8 * ALUMNO_LARGO_MAX) //!< bytes que alcanzan para los archivos de la prueba
+
+/* === Private data type declarations ============================================================================== */
+
+//! Datos de un alumno de prueba
+struct datos_s {
+    const char * nombre;   //!< nombre del alumno
+    const char * apellido; //!< apellido del alumno
+    uint32_t documento;    //!< documento del alumno
+};
+
+//! Par de alumnos de prueba y el archivo que se escribe con ellos; con memoria estática solo hay dos a la vez
+struct par_s {
+    struct datos_s alumnos[2]; //!< alumnos del archivo
+    const char * archivo;      //!< contenido que debe escribir CsvEscribir
+};
+
+//! Texto que un hilo escribe en una tubería mientras se lee del otro extremo
+struct tuberia_s {
+    int descriptor;     //!< extremo de escritura de la tubería, que se cierra al terminar
+    const char * texto; //!< caracteres a escribir
+    size_t largo;       //!< cantidad de caracteres a escribir
+    size_t pedazo;      //!< cantidad de caracteres de cada llamada a write
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Comprueba que un alumno tenga los datos esperados.
+ *
+ * @param alumno Alumno a comprobar.
+ * @param esperado Datos esperados.
+ * @return true si el alumno coincide.
+ */
+static bool Comprobar(alumno_t alumno, const struct datos_s * esperado);
+
+/**
+ * @brief Escribe en una tubería de a pedazos y la cierra al terminar.
+ *
+ * @param argumento Referencia a la descripción de la tubería, struct tuberia_s.
+ * @return Siempre NULL.
+ */
+static void * Alimentar(void * argumento);
+
+/**
+ * @brief Lee alumnos desde un archivo temporal o una tubería con el texto indicado.
+ *
+ * @param texto Contenido del archivo o la tubería.
+ * @param largo Cantidad de caracteres del contenido.
+ * @param pedazo Si es 0 se lee desde un archivo, sino desde una tubería donde se escriben pedazos de este largo.
+ * @param alumnos Arreglo donde se guardan los alumnos leídos.
+ * @param capacidad Cantidad de referencias que entran en el arreglo.
+ * @return Resultado de CsvLeer, o -1 si no se pudo preparar el archivo o la tubería.
+ */
+static int Cargar(const char texto[], size_t largo, size_t pedazo, alumno_t alumnos[], size_t capacidad);
+
+/**
+ * @brief Escribe un par de alumnos, compara el archivo con el esperado y lo vuelve a leer de todas las formas.
+ *
+ * @param par Alumnos y archivo esperado, que no se compara si es NULL.
+ * @return true si la prueba pasó.
+ */
+static bool ProbarIdaYVuelta(const struct par_s * par);
+
+/**
+ * @brief Prueba la lectura de archivos sin cabecera, con líneas vacías y con filas terminadas en "\r\n" o "\r".
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarVariantes(void);
+
+/**
+ * @brief Prueba que se rechacen las filas mal formadas y los archivos con más alumnos que la capacidad.
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarInvalidos(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Pares de alumnos de prueba, con campos que van entre comillas y campos vacíos
+static const struct par_s pares[] = {
+    {{{"Ana, María", "O\"Connor", 1}, {"línea\nnueva", "\"\"", UINT32_MAX}},
+     "nombre,apellido,documento\n\"Ana, María\",\"O\"\"Connor\",1\n\"línea\nnueva\",\"\"\"\"\"\",4294967295\n"},
+    {{{"", "", 0}, {"retorno\r", "simple", 42}}, "nombre,apellido,documento\n,,0\n\"retorno\r\",simple,42\n"},
+};
+
+static char comillas[ALUMNO_LARGO_MAX + 1]; //!< nombre del largo máximo hecho solo de comillas
+
+static char comas[ALUMNO_LARGO_MAX + 1]; //!< apellido del largo máximo hecho solo de comas
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+bool Comprobar(alumno_t alumno, const struct datos_s * esperado) {
+    if ((strcmp(AlumnoNombre(alumno), esperado->nombre) != 0) ||
+        (strcmp(AlumnoApellido(alumno), esperado->apellido) != 0) ||
+        (AlumnoDocumento(alumno) != esperado->documento)) {
+        printf("alumno distinto de \"%.40s\" \"%.40s\" %u\n", esperado->nombre, esperado->apellido,
+               (unsigned)esperado->documento);
+        return false;
+    }
+    return true;
+}
+
+void * Alimentar(void * argumento) {
+    struct tuberia_s * tuberia = argumento;
+
+    for (size_t escritos = 0; escritos < tuberia->largo;) {
+        size_t pedazo = tuberia->largo - escritos;
+        if (pedazo > tuberia->pedazo) {
+            pedazo = tuberia->pedazo;
+        }
+        ssize_t resultado = write(tuberia->descriptor, tuberia->texto + escritos, pedazo);
+        if (resultado <= 0) {
+            break;
+        }
+        escritos += (size_t)resultado;
+    }
+    close(tuberia->descriptor);
+    return NULL;
+}
+
+int Cargar(const char texto[], size_t largo, size_t pedazo, alumno_t alumnos[], size_t capacidad) {
+    int resultado = -1;
+
+    if (pedazo == 0) {
+        FILE * archivo = tmpfile();
+        if (archivo == NULL) {
+            return -1;
+        }
+        if ((fwrite(texto, 1, largo, archivo) == largo) && (fflush(archivo) == 0)) {
+            resultado = CsvLeer(fileno(archivo), alumnos, capacidad);
+        }
+        fclose(archivo);
+        return resultado;
+    }
+
+    struct tuberia_s tuberia = {.texto = texto, .largo = largo, .pedazo = pedazo};
+    int extremos[2];
+    pthread_t hilo;
+    if (pipe(extremos) != 0) {
+        return -1;
+    }
+    tuberia.descriptor = extremos[1];
+    if (pthread_create(&hilo, NULL, Alimentar, &tuberia) != 0) {
+        close(extremos[0]);
+        close(extremos[1]);
+        return -1;
+    }
+    resultado = CsvLeer(extremos[0], alumnos, capacidad);
+    // Si la lectura terminó antes de tiempo, cerrar la tubería hace que el hilo deje de escribir
+    close(extremos[0]);
+    pthread_join(hilo, NULL);
+    return resultado;
+}
+
+bool ProbarIdaYVuelta(const struct par_s * par) {
+    static char contenido[CONTENIDO_MAX];
+    static const size_t pedazos[] = {0, 1, 7, 4096};
+    alumno_t alumnos[2];
+    ssize_t largo = -1;
+    bool correcto = true;
+
+    for (size_t i = 0; i < 2; i++) {
+        alumnos[i] = AlumnoCrear((char *)par->alumnos[i].nombre, (char *)par->alumnos[i].apellido,
+                                 par->alumnos[i].documento);
+    }
+    FILE * archivo = tmpfile();
+    if ((archivo != NULL) && (CsvEscribir(alumnos, 2, fileno(archivo)) == 0) &&
+        (lseek(fileno(archivo), 0, SEEK_SET) == 0)) {
+        largo = read(fileno(archivo), contenido, sizeof(contenido));
+    }
+    if (archivo != NULL) {
+        fclose(archivo);
+    }
+    AlumnoDestruir(alumnos[0]);
+    AlumnoDestruir(alumnos[1]);
+    if ((largo <= 0) || ((size_t)largo == sizeof(contenido)) ||
+        ((par->archivo != NULL) &&
+         (((size_t)largo != strlen(par->archivo)) || (memcmp(contenido, par->archivo, (size_t)largo) != 0)))) {
+        printf("no se escribió el archivo esperado para \"%.40s\"\n", par->alumnos[0].nombre);
+        return false;
+    }
+
+    for (size_t i = 0; correcto && (i < sizeof(pedazos) / sizeof(pedazos[0])); i++) {
+        int cantidad = Cargar(contenido, (size_t)largo, pedazos[i], alumnos, 2);
+        correcto = (cantidad == 2) && Comprobar(alumnos[0], &par->alumnos[0]) &&
+                   Comprobar(alumnos[1], &par->alumnos[1]);
+        if (!correcto) {
+            printf("no se leyó el archivo de \"%.40s\" en pedazos de %zu\n", par->alumnos[0].nombre, pedazos[i]);
+        }
+        for (int j = 0; j < cantidad; j++) {
+            AlumnoDestruir(alumnos[j]);
+        }
+    }
+    return correcto;
+}
+
+bool ProbarVariantes(void) {
+    static const char sin_cabecera[] =
+        "\"Ana, María\",\"O\"\"Connor\",1\r\n\r\n\n\"línea\nnueva\",\"\"\"\"\"\",4294967295\r";
+    alumno_t alumnos[2];
+    bool correcto = true;
+
+    for (size_t pedazo = 0; correcto && (pedazo < 2); pedazo++) {
+        int cantidad = Cargar(sin_cabecera, sizeof(sin_cabecera) - 1, pedazo, alumnos, 2);
+        correcto = (cantidad == 2) && Comprobar(alumnos[0], &pares[0].alumnos[0]) &&
+                   Comprobar(alumnos[1], &pares[0].alumnos[1]);
+        for (int j = 0; j < cantidad; j++) {
+            AlumnoDestruir(alumnos[j]);
+        }
+        // La última fila puede no terminar en salto de línea
+        cantidad = Cargar(sin_cabecera, sizeof(sin_cabecera) - 2, pedazo, alumnos, 2);
+        correcto = correcto && (cantidad == 2) && Comprobar(alumnos[1], &pares[0].alumnos[1]);
+        for (int j = 0; j < cantidad; j++) {
+            AlumnoDestruir(alumnos[j]);
+        }
+        correcto = correcto && (Cargar("", 0, pedazo, alumnos, 2) == 0) &&
+                   (Cargar("nombre,apellido,documento\r\n", 27, pedazo, alumnos, 2) == 0);
+        if (!correcto) {
+            printf("no se aceptaron las variantes de fin de línea desde %s\n", pedazo ? "una tubería" : "un archivo");
+        }
+    }
+    return correcto;
+}
+
+bool ProbarInvalidos(void) {
+    static const char * const invalidos[] = {
+        "a,b\n",
+        "a,b,c\n",
+        "a,b,\n",
+        "a,b,1x\n",
+        "a,b,1,2\n",
+        "a,b,4294967296\n",
+        "a\"b,c,1\n",
+        "\"a\"x,b,1\n",
+        "\"a,b,1\n",
+        "a,b,1\n\"c",
+        "a,b,1\rx\n",
+        "a,b,1\nc,d,2\ne,f,3\n",
+    };
+    alumno_t alumnos[2];
+    bool correcto = true;
+
+    for (size_t i = 0; i < sizeof(invalidos) / sizeof(invalidos[0]); i++) {
+        for (size_t pedazo = 0; pedazo < 2; pedazo++) {
+            if (Cargar(invalidos[i], strlen(invalidos[i]), pedazo, alumnos, 2) != -1) {
+                printf("se aceptó el archivo \"%.40s\" desde %s\n", invalidos[i],
+                       pedazo ? "una tubería" : "un archivo");
+                correcto = false;
+            }
+        }
+    }
+
+    // Un carácter de más que el largo máximo, y un '\0' dentro de un campo
+    static char largo[ALUMNO_LARGO_MAX + 8];
+    memset(largo, 'a', ALUMNO_LARGO_MAX + 1);
+    memcpy(largo + ALUMNO_LARGO_MAX + 1, ",b,1\n", 5);
+    correcto = (Cargar(largo, ALUMNO_LARGO_MAX + 6, 0, alumnos, 2) == -1) && correcto;
+    correcto = (Cargar("\"a\0b\",c,1\n", 10, 0, alumnos, 2) == -1) && correcto;
+    return correcto;
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Ejecuta las pruebas de los archivos CSV de alumnos.
+ *
+ * @return 0 si todas las pruebas pasaron, 1 en otro caso.
+ */
+
+int main(void) {
+    // Las lecturas rechazadas cierran las tuberías mientras el hilo que las alimenta todavía puede estar escribiendo
+    signal(SIGPIPE, SIG_IGN);
+
+    // La fila más larga posible tiene sus dos textos entre comillas y todos sus caracteres duplicados o especiales
+    memset(comillas, '"', ALUMNO_LARGO_MAX);
+    memset(comas, ',', ALUMNO_LARGO_MAX);
+    const struct par_s maximo = {{{comillas, comas, UINT32_MAX}, {comas, comillas, 0}}, NULL};
+
+    bool correcto = true;
+    for (size_t i = 0; i < sizeof(pares) / sizeof(pares[0]); i++) {
+        correcto = ProbarIdaYVuelta(&pares[i]) && correcto;
+    }
+    correcto = ProbarIdaYVuelta(&maximo) && correcto;
+    correcto = ProbarVariantes() && correcto;
+    correcto = ProbarInvalidos() && correcto;
+
+    size_t cantidad;
+    if ((TextosMemoria(&cantidad) != 0) || (cantidad != 0)) {
+        printf("quedaron %zu textos sin liberar\n", cantidad);
+        correcto = false;
+    }
+
+    printf("csv: %s\n", correcto ? "correcto" : "incorrecto");
+    return correcto ? 0 : 1;
+}
+
+/* === End of documentation ======================================================================================== */
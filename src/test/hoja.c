@@ -0,0 +1,243 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file hoja.c
+ ** @brief prueba del orden de recálculo de las hojas de cálculo
+ **
+ ** Una fórmula solo puede evaluarse después de todas las fórmulas desactualizadas de las que depende, aunque una de
+ ** ellas también se alcance por otro camino del grafo. Se prueba primero un caso mínimo con dos caminos a la misma
+ ** celda y después una hoja con dependencias al azar, comparada con un cálculo directo en orden. Por último se
+ ** prueba que una definición rechazada no deje en la hoja las celdas que nombraba.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "hoja.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define ENTRADAS 8 //!< celdas de entrada de la hoja al azar
+
+#define CELDAS 200 //!< celdas de la hoja al azar, contando las entradas
+
+#define CAMBIOS 500 //!< cambios de una entrada seguidos de una consulta en la hoja al azar
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Operación de prueba que combina dos valores sin desbordar.
+ */
+static int Mezclar(int a, int b);
+
+/**
+ * @brief Consulta una celda y compara su valor con el esperado.
+ *
+ * @param hoja Hoja a consultar.
+ * @param nombre Nombre de la celda.
+ * @param esperado Valor esperado.
+ * @return true si la celda se evaluó sin errores y tiene el valor esperado.
+ */
+static bool Comprobar(hoja_t hoja, const char * nombre, int esperado);
+
+/**
+ * @brief Prueba el caso de una celda que se alcanza por dos caminos: x = 1, b = x + 1, c = b * 10, a = b + c.
+ *
+ * @param calculadora Calculadora con las operaciones de la prueba.
+ * @return true si todos los valores y la cantidad de evaluaciones son los esperados.
+ */
+static bool ProbarDosCaminos(calculadora_t calculadora);
+
+/**
+ * @brief Prueba una hoja en la que cada fórmula combina dos celdas anteriores elegidas al azar.
+ *
+ * @param calculadora Calculadora con las operaciones de la prueba.
+ * @return true si todas las consultas dan el mismo valor que el cálculo directo.
+ */
+static bool ProbarAlAzar(calculadora_t calculadora);
+
+/**
+ * @brief Prueba que las definiciones rechazadas no creen celdas, ni por ser circulares ni por no compilar.
+ *
+ * @param calculadora Calculadora con las operaciones de la prueba.
+ * @return true si las celdas nombradas solo por definiciones rechazadas no existen y las demás siguen existiendo.
+ */
+static bool ProbarRechazadas(calculadora_t calculadora);
+
+/**
+ * @brief Comprueba que una celda no exista en la hoja.
+ *
+ * @param hoja Hoja a consultar.
+ * @param nombre Nombre de la celda.
+ * @return true si la consulta informa que la celda no existe.
+ */
+static bool Inexistente(hoja_t hoja, const char * nombre);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+int Mezclar(int a, int b) {
+    return (a * 31 + b) % 1000;
+}
+
+bool Comprobar(hoja_t hoja, const char * nombre, int esperado) {
+    int valor;
+    calculadora_estado_t estado = HojaValor(hoja, nombre, &valor);
+
+    if ((estado != CALCULADORA_CORRECTO) || (valor != esperado)) {
+        printf("%s: estado %d, valor %d, esperado %d\n", nombre, estado, valor, esperado);
+        return false;
+    }
+    return true;
+}
+
+bool ProbarDosCaminos(calculadora_t calculadora) {
+    hoja_t hoja = HojaCrear(calculadora);
+    bool correcto = (hoja != NULL);
+
+    correcto = correcto && HojaAsignar(hoja, "x", 1);
+    correcto = correcto && (HojaDefinir(hoja, "b = x + 1") == CALCULADORA_CORRECTO);
+    correcto = correcto && (HojaDefinir(hoja, "c = b * 10") == CALCULADORA_CORRECTO);
+    correcto = correcto && (HojaDefinir(hoja, "a = b + c") == CALCULADORA_CORRECTO);
+    correcto = correcto && Comprobar(hoja, "a", 22) && Comprobar(hoja, "c", 20);
+
+    correcto = correcto && HojaAsignar(hoja, "x", 5);
+    correcto = correcto && Comprobar(hoja, "a", 66) && Comprobar(hoja, "c", 60);
+
+    // Cada fórmula se evalúa una sola vez por cambio: tres al definir y tres después de cambiar x
+    if (correcto && (HojaEvaluaciones(hoja) != 6)) {
+        printf("evaluaciones: %llu, esperadas 6\n", (unsigned long long)HojaEvaluaciones(hoja));
+        correcto = false;
+    }
+
+    HojaDestruir(hoja);
+    return correcto;
+}
+
+bool ProbarAlAzar(calculadora_t calculadora) {
+    static int primera[CELDAS];
+    static int segunda[CELDAS];
+    static int valores[CELDAS];
+    hoja_t hoja = HojaCrear(calculadora);
+    bool correcto = (hoja != NULL);
+    char texto[64];
+
+    srand(1);
+    for (int i = 0; correcto && (i < CELDAS); i++) {
+        if (i < ENTRADAS) {
+            snprintf(texto, sizeof(texto), "v%d", i);
+            correcto = HojaAsignar(hoja, texto, i);
+        } else {
+            primera[i] = rand() % i;
+            segunda[i] = rand() % i;
+            snprintf(texto, sizeof(texto), "v%d = v%d # v%d", i, primera[i], segunda[i]);
+            correcto = (HojaDefinir(hoja, texto) == CALCULADORA_CORRECTO);
+        }
+        valores[i] = (i < ENTRADAS) ? i : 0;
+    }
+
+    for (int cambio = 0; correcto && (cambio < CAMBIOS); cambio++) {
+        int entrada = rand() % ENTRADAS;
+        valores[entrada] = rand() % 1000;
+        snprintf(texto, sizeof(texto), "v%d", entrada);
+        correcto = HojaAsignar(hoja, texto, valores[entrada]);
+
+        for (int i = ENTRADAS; i < CELDAS; i++) {
+            valores[i] = Mezclar(valores[primera[i]], valores[segunda[i]]);
+        }
+        int consultada = ENTRADAS + rand() % (CELDAS - ENTRADAS);
+        snprintf(texto, sizeof(texto), "v%d", consultada);
+        correcto = correcto && Comprobar(hoja, texto, valores[consultada]);
+    }
+
+    HojaDestruir(hoja);
+    return correcto;
+}
+
+bool Inexistente(hoja_t hoja, const char * nombre) {
+    if (HojaValor(hoja, nombre, NULL) != CALCULADORA_EXPRESION_INVALIDA) {
+        printf("%s: la celda existe después de una definición rechazada\n", nombre);
+        return false;
+    }
+    return true;
+}
+
+bool ProbarRechazadas(calculadora_t calculadora) {
+    hoja_t hoja = HojaCrear(calculadora);
+    bool correcto = (hoja != NULL);
+    char texto[64];
+
+    // Suficientes celdas previas para que las nuevas caigan en las secuencias de sondeo de las existentes
+    for (int i = 0; correcto && (i < 100); i++) {
+        snprintf(texto, sizeof(texto), "p%d", i);
+        correcto = HojaAsignar(hoja, texto, i);
+    }
+
+    correcto = correcto && (HojaDefinir(hoja, "x = y + x") != CALCULADORA_CORRECTO);
+    correcto = correcto && Inexistente(hoja, "x") && Inexistente(hoja, "y");
+    correcto = correcto && (HojaDefinir(hoja, "z = a + b * ") != CALCULADORA_CORRECTO);
+    correcto = correcto && Inexistente(hoja, "z") && Inexistente(hoja, "a") && Inexistente(hoja, "b");
+
+    // Una definición que nombra muchas celdas nuevas, rechazada por circular al final, hace crecer la hoja
+    correcto = correcto && HojaAsignar(hoja, "w", 1);
+    correcto = correcto && (HojaDefinir(hoja, "c = w + 1") == CALCULADORA_CORRECTO);
+    correcto = correcto && (HojaDefinir(hoja, "w = n1 + n2 + n3 + n4 + n5 + n6 + n7 + n8 + n9 + c") !=
+                            CALCULADORA_CORRECTO);
+    correcto = correcto && Inexistente(hoja, "n1") && Inexistente(hoja, "n9") && Comprobar(hoja, "c", 2);
+
+    for (int i = 0; correcto && (i < 100); i++) {
+        snprintf(texto, sizeof(texto), "p%d", i);
+        correcto = Comprobar(hoja, texto, i);
+    }
+
+    HojaDestruir(hoja);
+    return correcto;
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Ejecuta las pruebas de recálculo de las hojas de cálculo.
+ *
+ * @return 0 si todas las pruebas pasaron, 1 en otro caso.
+ */
+
+int main(void) {
+    calculadora_t calculadora = CalculadoraCrear();
+    bool correcto = (calculadora != NULL);
+
+    correcto = correcto && CalculadoraAddOperacion(calculadora, '+', OperacionAdd);
+    correcto = correcto && CalculadoraAddOperacion(calculadora, '*', OperacionMul);
+    correcto = correcto && CalculadoraAddOperacion(calculadora, '#', Mezclar);
+    correcto = correcto && ProbarDosCaminos(calculadora) && ProbarAlAzar(calculadora);
+    correcto = correcto && ProbarRechazadas(calculadora);
+
+    CalculadoraDestruir(calculadora);
+    printf("recalculo de hojas: %s\n", correcto ? "correcto" : "incorrecto");
+    return correcto ? 0 : 1;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,193 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file textos.c
+ ** @brief prueba de las referencias y la reutilización de espacio del módulo de textos
+ **
+ ** Se prueba que un texto internado varias veces siga disponible hasta liberar su última referencia, que los textos
+ ** liberados se quiten de la tabla sin perder los que comparten lugares con ellos, y que después de crear y liberar
+ ** muchos textos de largos distintos la memoria vuelva a estar entera, de modo que con memoria estática se puedan
+ ** seguir guardando textos del largo máximo de un alumno.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "textos.h"
+#include "alumno.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define VIVOS 24 //!< textos guardados a la vez durante la prueba al azar
+
+#define VUELTAS 20000 //!< reemplazos de textos en la prueba al azar
+
+#define LARGO_AZAR 200 //!< largo máximo de los textos de la prueba al azar
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Comprueba que un texto internado tenga los caracteres esperados.
+ *
+ * @param texto Número del texto.
+ * @param esperado Caracteres esperados, terminados en '\0'.
+ * @return true si el texto coincide.
+ */
+static bool Comprobar(texto_t texto, const char * esperado);
+
+/**
+ * @brief Prueba que un texto se conserve mientras queden referencias y se libere con la última.
+ *
+ * @return true si la prueba pasó.
+ */
+static bool ProbarReferencias(void);
+
+/**
+ * @brief Reemplaza al azar textos de largos distintos y comprueba que la tabla y los espacios sigan coherentes.
+ *
+ * @return true si todos los textos vivos se conservaron y al final no quedó memoria ocupada.
+ */
+static bool ProbarAlAzar(void);
+
+/**
+ * @brief Comprueba que, liberados todos los textos, vuelvan a entrar los nombres más largos de dos alumnos.
+ *
+ * @return true si se pudieron guardar cuatro textos de ALUMNO_LARGO_MAX caracteres.
+ */
+static bool ProbarLargoMaximo(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static char caracteres[VIVOS][LARGO_AZAR + 1]; //!< caracteres de los textos vivos de la prueba al azar
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+bool Comprobar(texto_t texto, const char * esperado) {
+    if ((texto == TEXTO_INVALIDO) || (TextosLargo(texto) != strlen(esperado)) ||
+        (strcmp(TextosCadena(texto), esperado) != 0)) {
+        printf("texto %08x distinto de \"%.40s\"\n", (unsigned)texto, esperado);
+        return false;
+    }
+    return true;
+}
+
+bool ProbarReferencias(void) {
+    texto_t primero = TextosInternar("Alejandro", 9);
+    texto_t segundo = TextosInternar("Alejandro", 9);
+    bool correcto = Comprobar(primero, "Alejandro") && (segundo == primero);
+
+    TextosLiberar(primero);
+    correcto = correcto && Comprobar(segundo, "Alejandro");
+    TextosLiberar(segundo);
+
+    size_t cantidad;
+    if (correcto && ((TextosMemoria(&cantidad) != 0) || (cantidad != 0))) {
+        printf("quedaron %zu textos después de liberar la última referencia\n", cantidad);
+        correcto = false;
+    }
+    correcto = correcto && (TextosInternar("", 0) == TEXTO_VACIO);
+    TextosLiberar(TEXTO_VACIO);
+    TextosLiberar(TEXTO_INVALIDO);
+    return correcto;
+}
+
+bool ProbarAlAzar(void) {
+    texto_t vivos[VIVOS] = {0};
+    bool correcto = true;
+
+    srand(7);
+    for (int vuelta = 0; correcto && (vuelta < VUELTAS); vuelta++) {
+        int i = rand() % VIVOS;
+        TextosLiberar(vivos[i]);
+
+        // Los textos cortos se repiten seguido para que la tabla tenga colisiones y textos compartidos
+        size_t largo = 1 + (size_t)rand() % ((rand() % 4) ? 8 : LARGO_AZAR);
+        for (size_t j = 0; j < largo; j++) {
+            caracteres[i][j] = (char)('a' + rand() % 3);
+        }
+        caracteres[i][largo] = '\0';
+        vivos[i] = TextosInternar(caracteres[i], largo);
+
+        for (int j = 0; correcto && (j < VIVOS); j++) {
+            correcto = (vivos[j] == TEXTO_VACIO) || Comprobar(vivos[j], caracteres[j]);
+        }
+        // Volver a internar un texto vivo debe encontrarlo en la tabla y no guardar otra copia
+        int k = rand() % VIVOS;
+        texto_t repetido = TextosInternar(caracteres[k], strlen(caracteres[k]));
+        if (correcto && (repetido != vivos[k])) {
+            printf("el texto \"%.40s\" se guardó dos veces\n", caracteres[k]);
+            correcto = false;
+        }
+        TextosLiberar(repetido);
+    }
+    for (int i = 0; i < VIVOS; i++) {
+        TextosLiberar(vivos[i]);
+    }
+
+    size_t cantidad;
+    if (correcto && ((TextosMemoria(&cantidad) != 0) || (cantidad != 0))) {
+        printf("quedaron %zu textos ocupados al terminar\n", cantidad);
+        correcto = false;
+    }
+    return correcto;
+}
+
+bool ProbarLargoMaximo(void) {
+    static char largo[4][ALUMNO_LARGO_MAX + 1];
+    texto_t textos[4];
+    bool correcto = true;
+
+    for (int i = 0; i < 4; i++) {
+        memset(largo[i], 'A' + i, ALUMNO_LARGO_MAX);
+        largo[i][ALUMNO_LARGO_MAX] = '\0';
+        textos[i] = TextosInternar(largo[i], ALUMNO_LARGO_MAX);
+        correcto = Comprobar(textos[i], largo[i]) && correcto;
+    }
+    for (int i = 0; i < 4; i++) {
+        TextosLiberar(textos[i]);
+    }
+    return correcto;
+}
+
+/* === Public function implementation ============================================================================== */
+
+/**
+ * @brief Ejecuta las pruebas del módulo de textos.
+ *
+ * @return 0 si todas las pruebas pasaron, 1 en otro caso.
+ */
+
+int main(void) {
+    bool correcto = ProbarReferencias();
+    correcto = ProbarAlAzar() && correcto;
+    correcto = ProbarLargoMaximo() && correcto;
+
+    printf("textos: %s\n", correcto ? "correcto" : "incorrecto");
+    return correcto ? 0 : 1;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,539 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file textos.c
+ ** @brief codigo fuente del módulo de textos compartidos e internados
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "textos.h"
+#include "config.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define BLOQUE_BITS 20 //!< bits de la posición de un texto dentro de su bloque
+
+#define BLOQUE_TAMANO ((size_t)1 << BLOQUE_BITS) //!< bytes de cada bloque de textos
+
+#define BLOQUES_MAX ((size_t)1 << (32 - BLOQUE_BITS)) //!< cantidad máxima de bloques de textos
+
+#define TEXTO(bloque, posicion) ((texto_t)(((bloque) << BLOQUE_BITS) | (posicion))) //!< arma el número de un texto
+
+#define TEXTO_BLOQUE(texto) ((texto) >> BLOQUE_BITS) //!< bloque donde está guardado un texto
+
+#define TEXTO_POSICION(texto) ((texto) & (BLOQUE_TAMANO - 1)) //!< posición de un texto dentro de su bloque
+
+#define CLASE_BITS 5 //!< bits del espacio más chico que puede ocupar un texto
+
+#define CLASES (BLOQUE_BITS - CLASE_BITS + 1) //!< cantidad de clases de tamaño, la última ocupa un bloque entero
+
+#define CLASE_TAMANO(clase) ((size_t)1 << (CLASE_BITS + (clase))) //!< bytes del espacio de una clase de tamaño
+
+#define CABECERA sizeof(struct cabecera_s) //!< bytes que ocupa la cabecera guardada delante de cada texto
+
+#ifdef USAR_MEMORIA_ESTATICA
+#define LUGARES_MAX (2 * (TEXTOS_MEMORIA / CLASE_TAMANO(0)) + 2) //!< lugares de la tabla, el doble de los textos posibles
+#else
+#define LUGARES_MINIMO 1024 //!< cantidad de lugares con la que empieza la tabla de búsqueda
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Cabecera que precede a los caracteres de cada texto y a cada espacio libre.
+ */
+
+struct cabecera_s {
+    _Atomic uint32_t referencias; //!< referencias entregadas y no liberadas, 0 si el espacio está libre
+    uint8_t clase;                //!< clase de tamaño del espacio
+    uint8_t libre;                //!< 1 si el espacio está en una lista de espacios libres
+    uint16_t largo;               //!< cantidad de caracteres del texto
+};
+
+/**
+ * @brief Espacio libre de un bloque, enlazado con los demás espacios libres de su clase de tamaño.
+ */
+
+struct libre_s {
+    struct cabecera_s cabecera; //!< cabecera del espacio, con la clase y la marca de libre
+    uint32_t bloque;            //!< bloque al que pertenece el espacio
+    struct libre_s * anterior;  //!< espacio libre anterior de la misma clase, o NULL
+    struct libre_s * siguiente; //!< espacio libre siguiente de la misma clase, o NULL
+};
+
+_Static_assert(sizeof(struct cabecera_s) == 8, "la cabecera debe mantener alineados los textos");
+_Static_assert(sizeof(struct libre_s) <= CLASE_TAMANO(0), "un espacio libre debe entrar en la clase más chica");
+
+/**
+ * @brief Lugar de la tabla de búsqueda, con el resumen del texto para no comparar textos que no pueden ser iguales.
+ */
+
+struct lugar_s {
+    uint32_t resumen; //!< resumen del texto
+    texto_t texto;    //!< número del texto, o TEXTO_VACIO si el lugar está libre
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula el resumen FNV-1a de un texto.
+ *
+ * @param texto Caracteres del texto.
+ * @param largo Cantidad de caracteres.
+ * @return Resumen de 32 bits.
+ */
+static uint32_t Resumir(const char texto[], size_t largo);
+
+/**
+ * @brief Calcula el lugar de la tabla donde empieza la búsqueda de un texto.
+ *
+ * @param resumen Resumen del texto.
+ * @param cantidad Cantidad de lugares de la tabla.
+ * @return Primer lugar a revisar.
+ */
+static size_t Inicio(uint32_t resumen, size_t cantidad);
+
+/**
+ * @brief Obtiene la cabecera de un texto guardado.
+ *
+ * @param texto Número del texto, distinto de TEXTO_VACIO.
+ * @return Cabecera del texto.
+ */
+static struct cabecera_s * Cabecera(texto_t texto);
+
+/**
+ * @brief Busca un texto en la tabla, con el cerrojo tomado.
+ *
+ * @param texto Caracteres del texto.
+ * @param largo Cantidad de caracteres.
+ * @param resumen Resumen del texto.
+ * @param lugar Variable donde se guarda el lugar donde terminó la búsqueda, el del texto o uno libre, puede ser NULL.
+ * @return Número del texto, o TEXTO_INVALIDO si no está en la tabla.
+ */
+static texto_t Buscar(const char texto[], size_t largo, uint32_t resumen, size_t * lugar);
+
+/**
+ * @brief Quita un texto de la tabla, acercando a su lugar inicial los que siguen, con el cerrojo de escritura.
+ *
+ * @param lugar Lugar que ocupa el texto en la tabla.
+ */
+static void Quitar(size_t lugar);
+
+/**
+ * @brief Agrega un espacio a la lista de espacios libres de su clase.
+ *
+ * @param libre Espacio a agregar.
+ * @param clase Clase de tamaño del espacio.
+ * @param bloque Bloque al que pertenece el espacio.
+ */
+static void Enlazar(struct libre_s * libre, unsigned clase, uint32_t bloque);
+
+/**
+ * @brief Quita un espacio de la lista de espacios libres de su clase.
+ *
+ * @param libre Espacio a quitar.
+ */
+static void Desenlazar(struct libre_s * libre);
+
+/**
+ * @brief Reserva un bloque nuevo y lo agrega entero como espacio libre, con el cerrojo de escritura.
+ *
+ * @return true si se agregó un bloque, false si no hay memoria.
+ */
+static bool AgregarBloque(void);
+
+/**
+ * @brief Toma un espacio libre de una clase, dividiendo uno mayor si no hay, con el cerrojo de escritura.
+ *
+ * @param clase Clase de tamaño del espacio.
+ * @return Espacio reservado, o NULL si no hay memoria.
+ */
+static struct libre_s * Reservar(unsigned clase);
+
+/**
+ * @brief Copia un texto en un espacio libre, con el cerrojo de escritura.
+ *
+ * @param texto Caracteres del texto.
+ * @param largo Cantidad de caracteres.
+ * @return Número del texto guardado con una referencia, o TEXTO_INVALIDO si no hay memoria.
+ */
+static texto_t Guardar(const char texto[], size_t largo);
+
+/**
+ * @brief Devuelve el espacio de un texto, uniéndolo con su compañero mientras este también esté libre, con el
+ *        cerrojo de escritura.
+ *
+ * @param texto Número del texto, que ya no tiene referencias ni está en la tabla.
+ */
+static void Devolver(texto_t texto);
+
+#ifndef USAR_MEMORIA_ESTATICA
+/**
+ * @brief Duplica la cantidad de lugares de la tabla y vuelve a ubicar los textos, con el cerrojo de escritura.
+ *
+ * @return true si se agrandó la tabla, false si no hay memoria.
+ */
+static bool Agrandar(void);
+#endif
+
+/* === Private variable definitions ================================================================================ */
+
+#ifdef USAR_MEMORIA_ESTATICA
+
+static _Alignas(max_align_t) char memoria[TEXTOS_MEMORIA]; //!< memoria de la que se toman los bloques de textos
+
+static size_t reservado = 0; //!< bytes de la memoria estática entregados a los bloques
+
+static struct lugar_s lugares_fijos[LUGARES_MAX]; //!< lugares de la tabla de búsqueda
+
+static struct lugar_s * lugares = lugares_fijos; //!< tabla de búsqueda de textos por su contenido
+
+static size_t cantidad_lugares = LUGARES_MAX; //!< cantidad de lugares de la tabla
+
+#else
+
+static struct lugar_s * lugares = NULL; //!< tabla de búsqueda de textos por su contenido
+
+static size_t cantidad_lugares = 0; //!< cantidad de lugares de la tabla
+
+#endif
+
+static char * _Atomic bloques[BLOQUES_MAX] = {0}; //!< bloques de textos, que no se mueven una vez reservados
+
+static uint8_t clases_bloques[BLOQUES_MAX] = {0}; //!< clase de tamaño del espacio que ocupa cada bloque entero
+
+static size_t cantidad_bloques = 0; //!< cantidad de bloques reservados
+
+static struct libre_s * libres[CLASES] = {0}; //!< listas de espacios libres de cada clase de tamaño
+
+static size_t distintos = 0; //!< cantidad de textos guardados
+
+static size_t usados = 0; //!< bytes ocupados por los espacios de los textos guardados
+
+static pthread_rwlock_t cerrojo = PTHREAD_RWLOCK_INITIALIZER; //!< protege la tabla y los espacios de los bloques
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+uint32_t Resumir(const char texto[], size_t largo) {
+    uint32_t resumen = 2166136261u;
+
+    for (size_t i = 0; i < largo; i++) {
+        resumen = (resumen ^ (unsigned char)texto[i]) * 16777619u;
+    }
+    return resumen;
+}
+
+size_t Inicio(uint32_t resumen, size_t cantidad) {
+    return (size_t)(((uint64_t)resumen * cantidad) >> 32);
+}
+
+struct cabecera_s * Cabecera(texto_t texto) {
+    return (struct cabecera_s *)(TextosCadena(texto) - CABECERA);
+}
+
+texto_t Buscar(const char texto[], size_t largo, uint32_t resumen, size_t * lugar) {
+    if (cantidad_lugares == 0) {
+        return TEXTO_INVALIDO;
+    }
+    for (size_t actual = Inicio(resumen, cantidad_lugares);; actual = (actual + 1) % cantidad_lugares) {
+        texto_t encontrado = lugares[actual].texto;
+        if ((encontrado == TEXTO_VACIO) ||
+            ((lugares[actual].resumen == resumen) && (TextosLargo(encontrado) == largo) &&
+             (memcmp(TextosCadena(encontrado), texto, largo) == 0))) {
+            if (lugar) {
+                *lugar = actual;
+            }
+            return (encontrado == TEXTO_VACIO) ? TEXTO_INVALIDO : encontrado;
+        }
+    }
+}
+
+void Quitar(size_t lugar) {
+    size_t siguiente = lugar;
+
+    while (true) {
+        siguiente = (siguiente + 1) % cantidad_lugares;
+        if (lugares[siguiente].texto == TEXTO_VACIO) {
+            break;
+        }
+        // El texto puede pasar al lugar vacío si este no queda antes de su lugar inicial
+        size_t inicio = Inicio(lugares[siguiente].resumen, cantidad_lugares);
+        size_t desplazamiento = (siguiente + cantidad_lugares - inicio) % cantidad_lugares;
+        if (desplazamiento >= (siguiente + cantidad_lugares - lugar) % cantidad_lugares) {
+            lugares[lugar] = lugares[siguiente];
+            lugar = siguiente;
+        }
+    }
+    lugares[lugar] = (struct lugar_s){0, TEXTO_VACIO};
+}
+
+void Enlazar(struct libre_s * libre, unsigned clase, uint32_t bloque) {
+    atomic_store_explicit(&libre->cabecera.referencias, 0, memory_order_relaxed);
+    libre->cabecera.clase = (uint8_t)clase;
+    libre->cabecera.libre = 1;
+    libre->bloque = bloque;
+    libre->anterior = NULL;
+    libre->siguiente = libres[clase];
+    if (libre->siguiente) {
+        libre->siguiente->anterior = libre;
+    }
+    libres[clase] = libre;
+}
+
+void Desenlazar(struct libre_s * libre) {
+    if (libre->anterior) {
+        libre->anterior->siguiente = libre->siguiente;
+    } else {
+        libres[libre->cabecera.clase] = libre->siguiente;
+    }
+    if (libre->siguiente) {
+        libre->siguiente->anterior = libre->anterior;
+    }
+    libre->cabecera.libre = 0;
+}
+
+bool AgregarBloque(void) {
+    unsigned clase = CLASES - 1;
+
+    if (cantidad_bloques == BLOQUES_MAX) {
+        return false;
+    }
+#ifdef USAR_MEMORIA_ESTATICA
+    // Los bloques se toman de mayor a menor para que cada uno quede alineado a su tamaño dentro de la memoria
+    size_t restante = sizeof(memoria) - reservado;
+    while ((clase > 0) && (CLASE_TAMANO(clase) > restante)) {
+        clase--;
+    }
+    if (CLASE_TAMANO(clase) > restante) {
+        return false;
+    }
+    char * bloque = memoria + reservado;
+    reservado += CLASE_TAMANO(clase);
+#else
+    char * bloque = malloc(BLOQUE_TAMANO);
+    if (bloque == NULL) {
+        return false;
+    }
+#endif
+    clases_bloques[cantidad_bloques] = (uint8_t)clase;
+    atomic_store_explicit(&bloques[cantidad_bloques], bloque, memory_order_release);
+    Enlazar((struct libre_s *)bloque, clase, (uint32_t)cantidad_bloques);
+    cantidad_bloques++;
+    return true;
+}
+
+struct libre_s * Reservar(unsigned clase) {
+    unsigned mayor;
+
+    do {
+        mayor = clase;
+        while ((mayor < CLASES) && (libres[mayor] == NULL)) {
+            mayor++;
+        }
+    } while ((mayor == CLASES) && AgregarBloque());
+    if (mayor == CLASES) {
+        return NULL;
+    }
+
+    struct libre_s * libre = libres[mayor];
+    Desenlazar(libre);
+    while (mayor > clase) {
+        mayor--;
+        Enlazar((struct libre_s *)((char *)libre + CLASE_TAMANO(mayor)), mayor, libre->bloque);
+    }
+    return libre;
+}
+
+texto_t Guardar(const char texto[], size_t largo) {
+    unsigned clase = 0;
+
+    while (CLASE_TAMANO(clase) < CABECERA + largo + 1) {
+        clase++;
+    }
+    struct libre_s * libre = Reservar(clase);
+    if (libre == NULL) {
+        return TEXTO_INVALIDO;
+    }
+
+    uint32_t bloque = libre->bloque;
+    struct cabecera_s * cabecera = &libre->cabecera;
+    atomic_store_explicit(&cabecera->referencias, 1, memory_order_relaxed);
+    cabecera->clase = (uint8_t)clase;
+    cabecera->libre = 0;
+    cabecera->largo = (uint16_t)largo;
+    char * destino = (char *)(cabecera + 1);
+    memcpy(destino, texto, largo);
+    destino[largo] = '\0';
+
+    usados += CLASE_TAMANO(clase);
+    distintos++;
+    return TEXTO(bloque, (size_t)(destino - atomic_load_explicit(&bloques[bloque], memory_order_relaxed)));
+}
+
+void Devolver(texto_t texto) {
+    uint32_t bloque = TEXTO_BLOQUE(texto);
+    char * inicio = atomic_load_explicit(&bloques[bloque], memory_order_relaxed);
+    size_t posicion = TEXTO_POSICION(texto) - CABECERA;
+    unsigned clase = Cabecera(texto)->clase;
+
+    usados -= CLASE_TAMANO(clase);
+    distintos--;
+    while (clase < clases_bloques[bloque]) {
+        struct libre_s * companero = (struct libre_s *)(inicio + (posicion ^ CLASE_TAMANO(clase)));
+        if (!companero->cabecera.libre || (companero->cabecera.clase != clase)) {
+            break;
+        }
+        Desenlazar(companero);
+        posicion &= ~CLASE_TAMANO(clase);
+        clase++;
+    }
+    Enlazar((struct libre_s *)(inicio + posicion), clase, bloque);
+}
+
+#ifndef USAR_MEMORIA_ESTATICA
+bool Agrandar(void) {
+    size_t cantidad = (cantidad_lugares == 0) ? LUGARES_MINIMO : 2 * cantidad_lugares;
+    struct lugar_s * nuevos = calloc(cantidad, sizeof(struct lugar_s));
+
+    if (nuevos == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < cantidad_lugares; i++) {
+        if (lugares[i].texto != TEXTO_VACIO) {
+            size_t lugar = Inicio(lugares[i].resumen, cantidad);
+            while (nuevos[lugar].texto != TEXTO_VACIO) {
+                lugar = (lugar + 1) % cantidad;
+            }
+            nuevos[lugar] = lugares[i];
+        }
+    }
+    free(lugares);
+    lugares = nuevos;
+    cantidad_lugares = cantidad;
+    return true;
+}
+#endif
+
+/* === Public function implementation ============================================================================== */
+
+texto_t TextosInternar(const char texto[], size_t largo) {
+    if (largo == 0) {
+        return TEXTO_VACIO;
+    }
+    if ((largo > TEXTOS_LARGO_MAX) || (memchr(texto, '\0', largo) != NULL)) {
+        return TEXTO_INVALIDO;
+    }
+
+    // Con el cerrojo de lectura tomado ningún texto de la tabla puede perder su última referencia
+    uint32_t resumen = Resumir(texto, largo);
+    pthread_rwlock_rdlock(&cerrojo);
+    texto_t resultado = Buscar(texto, largo, resumen, NULL);
+    if (resultado != TEXTO_INVALIDO) {
+        atomic_fetch_add_explicit(&Cabecera(resultado)->referencias, 1, memory_order_relaxed);
+    }
+    pthread_rwlock_unlock(&cerrojo);
+    if (resultado != TEXTO_INVALIDO) {
+        return resultado;
+    }
+
+    // Otro hilo pudo guardar el mismo texto entre la búsqueda y la toma del cerrojo de escritura
+    size_t libre;
+    pthread_rwlock_wrlock(&cerrojo);
+#ifndef USAR_MEMORIA_ESTATICA
+    // La tabla se mantiene a lo sumo medio llena para que las búsquedas recorran pocos lugares
+    if ((2 * (distintos + 1) > cantidad_lugares) && !Agrandar()) {
+        pthread_rwlock_unlock(&cerrojo);
+        return TEXTO_INVALIDO;
+    }
+#endif
+    resultado = Buscar(texto, largo, resumen, &libre);
+    if (resultado != TEXTO_INVALIDO) {
+        atomic_fetch_add_explicit(&Cabecera(resultado)->referencias, 1, memory_order_relaxed);
+    } else {
+        resultado = Guardar(texto, largo);
+        if (resultado != TEXTO_INVALIDO) {
+            lugares[libre] = (struct lugar_s){resumen, resultado};
+        }
+    }
+    pthread_rwlock_unlock(&cerrojo);
+    return resultado;
+}
+
+void TextosLiberar(texto_t texto) {
+    if ((texto == TEXTO_VACIO) || (texto == TEXTO_INVALIDO)) {
+        return;
+    }
+
+    // Mientras queden otras referencias se descuenta sin cerrojo; la última se quita con el cerrojo de escritura
+    // para que ninguna búsqueda encuentre el texto mientras se devuelve su espacio
+    struct cabecera_s * cabecera = Cabecera(texto);
+    uint32_t referencias = atomic_load_explicit(&cabecera->referencias, memory_order_relaxed);
+    while (referencias > 1) {
+        if (atomic_compare_exchange_weak_explicit(&cabecera->referencias, &referencias, referencias - 1,
+                                                  memory_order_release, memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    pthread_rwlock_wrlock(&cerrojo);
+    if (atomic_fetch_sub_explicit(&cabecera->referencias, 1, memory_order_acq_rel) == 1) {
+        size_t lugar;
+        size_t largo = TextosLargo(texto);
+        Buscar(TextosCadena(texto), largo, Resumir(TextosCadena(texto), largo), &lugar);
+        Quitar(lugar);
+        Devolver(texto);
+    }
+    pthread_rwlock_unlock(&cerrojo);
+}
+
+const char * TextosCadena(texto_t texto) {
+    if (texto == TEXTO_VACIO) {
+        return "";
+    }
+    char * bloque = atomic_load_explicit(&bloques[TEXTO_BLOQUE(texto)], memory_order_acquire);
+    return bloque + TEXTO_POSICION(texto);
+}
+
+size_t TextosLargo(texto_t texto) {
+    if (texto == TEXTO_VACIO) {
+        return 0;
+    }
+    return Cabecera(texto)->largo;
+}
+
+size_t TextosMemoria(size_t * cantidad) {
+    pthread_rwlock_rdlock(&cerrojo);
+    size_t resultado = usados;
+    if (cantidad) {
+        *cantidad = distintos;
+    }
+    pthread_rwlock_unlock(&cerrojo);
+    return resultado;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,311 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan Jesus Alejandro kechuroldanjesus@gmail.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file vector.c
+ ** @brief codigo fuente del módulo de operaciones aritméticas elemento a elemento sobre arreglos de enteros
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "vector.h"
+#include <limits.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define VECTOR_X86 //!< se compilan las implementaciones con extensiones SIMD de x86
+#endif
+
+/* === Macros definitions ========================================================================================== */
+
+/**
+ * @brief Define una implementación escalar de una operación elemento a elemento.
+ *
+ * @param nombre Nombre de la función a definir.
+ * @param escalar Función que calcula un único resultado a partir de dos operandos.
+ */
+#define KERNEL_ESCALAR(nombre, escalar)                                                                                \
+    static void nombre(const int a[], const int b[], int salida[], size_t n) {                                         \
+        for (size_t i = 0; i < n; i++) {                                                                               \
+            salida[i] = escalar(a[i], b[i]);                                                                           \
+        }                                                                                                              \
+    }
+
+/**
+ * @brief Define una implementación SIMD de una operación elemento a elemento.
+ *
+ * Procesa los elementos de a `ancho` por iteración y termina los que sobran con la versión escalar.
+ *
+ * @param nombre Nombre de la función a definir.
+ * @param extension Extensión del procesador que necesita la función, como se indica en el atributo target.
+ * @param tipo Tipo de registro SIMD.
+ * @param ancho Cantidad de enteros que entran en un registro.
+ * @param cargar Instrucción de carga no alineada.
+ * @param guardar Instrucción de almacenamiento no alineado.
+ * @param operar Instrucción o función que combina dos registros.
+ * @param escalar Función que calcula un único resultado a partir de dos operandos.
+ */
+#define KERNEL_SIMD(nombre, extension, tipo, ancho, cargar, guardar, operar, escalar)                                  \
+    __attribute__((target(extension))) static void nombre(const int a[], const int b[], int salida[], size_t n) {      \
+        size_t i = 0;                                                                                                  \
+        for (; i + (ancho) <= n; i += (ancho)) {                                                                       \
+            tipo x = cargar((const tipo *)(a + i));                                                                    \
+            tipo y = cargar((const tipo *)(b + i));                                                                    \
+            guardar((tipo *)(salida + i), operar(x, y));                                                               \
+        }                                                                                                              \
+        for (; i < n; i++) {                                                                                           \
+            salida[i] = escalar(a[i], b[i]);                                                                           \
+        }                                                                                                              \
+    }
+
+/**
+ * @brief Define una implementación escalar de la reducción de un arreglo con una operación.
+ *
+ * @param nombre Nombre de la función a definir.
+ * @param escalar Función que combina dos operandos.
+ * @param neutro Elemento neutro de la operación.
+ */
+#define REDUCCION_ESCALAR(nombre, escalar, neutro)                                                                     \
+    static int nombre(const int a[], size_t n) {                                                                       \
+        int resultado = (neutro);                                                                                      \
+        for (size_t i = 0; i < n; i++) {                                                                               \
+            resultado = escalar(resultado, a[i]);                                                                      \
+        }                                                                                                              \
+        return resultado;                                                                                              \
+    }
+
+/**
+ * @brief Define una implementación SIMD de la reducción de un arreglo con una operación asociativa y conmutativa.
+ *
+ * Cada carril del registro acumula un subconjunto de los elementos; al final se combinan los carriles entre sí y con
+ * los elementos que sobran.
+ *
+ * @param nombre Nombre de la función a definir.
+ * @param extension Extensión del procesador que necesita la función, como se indica en el atributo target.
+ * @param tipo Tipo de registro SIMD.
+ * @param ancho Cantidad de enteros que entran en un registro.
+ * @param cargar Instrucción de carga no alineada.
+ * @param guardar Instrucción de almacenamiento no alineado.
+ * @param repetir Instrucción que copia un entero en todos los carriles.
+ * @param operar Instrucción que combina dos registros.
+ * @param escalar Función que combina dos operandos.
+ * @param neutro Elemento neutro de la operación.
+ */
+#define REDUCCION_SIMD(nombre, extension, tipo, ancho, cargar, guardar, repetir, operar, escalar, neutro)              \
+    __attribute__((target(extension))) static int nombre(const int a[], size_t n) {                                    \
+        tipo acumulado = repetir(neutro);                                                                              \
+        int carriles[(ancho)];                                                                                         \
+        int resultado = (neutro);                                                                                      \
+        size_t i = 0;                                                                                                  \
+        for (; i + (ancho) <= n; i += (ancho)) {                                                                       \
+            acumulado = operar(acumulado, cargar((const tipo *)(a + i)));                                              \
+        }                                                                                                              \
+        guardar((tipo *)carriles, acumulado);                                                                          \
+        for (size_t j = 0; j < (ancho); j++) {                                                                         \
+            resultado = escalar(resultado, carriles[j]);                                                               \
+        }                                                                                                              \
+        for (; i < n; i++) {                                                                                           \
+            resultado = escalar(resultado, a[i]);                                                                      \
+        }                                                                                                              \
+        return resultado;                                                                                              \
+    }
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Implementaciones elegidas para el procesador en uso.
+ */
+
+struct implementaciones_s {
+    vector_operacion_t sumar;       //!< implementación de VectorSumar
+    vector_operacion_t restar;      //!< implementación de VectorRestar
+    vector_operacion_t multiplicar; //!< implementación de VectorMultiplicar
+    vector_operacion_t dividir;     //!< implementación de VectorDividir
+    vector_reduccion_t sumar_todos;       //!< implementación de VectorSumarTodos
+    vector_reduccion_t multiplicar_todos; //!< implementación de VectorMultiplicarTodos
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Suma dos enteros con aritmética módulo 2^32.
+ */
+static inline int SumarEscalar(int a, int b);
+
+/**
+ * @brief Resta dos enteros con aritmética módulo 2^32.
+ */
+static inline int RestarEscalar(int a, int b);
+
+/**
+ * @brief Multiplica dos enteros con aritmética módulo 2^32.
+ */
+static inline int MultiplicarEscalar(int a, int b);
+
+/**
+ * @brief Divide dos enteros dando 0 si el divisor es cero e INT_MIN en INT_MIN / -1.
+ */
+static inline int DividirEscalar(int a, int b);
+
+/**
+ * @brief Elige las implementaciones según las extensiones que soporta el procesador.
+ */
+static void ElegirImplementaciones(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct implementaciones_s implementaciones; //!< implementaciones elegidas al primer uso
+
+static pthread_once_t implementaciones_elegidas = PTHREAD_ONCE_INIT; //!< controla la elección única
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+int SumarEscalar(int a, int b) {
+    return (int)((unsigned)a + (unsigned)b);
+}
+
+int RestarEscalar(int a, int b) {
+    return (int)((unsigned)a - (unsigned)b);
+}
+
+int MultiplicarEscalar(int a, int b) {
+    return (int)((unsigned)a * (unsigned)b);
+}
+
+int DividirEscalar(int a, int b) {
+    if (b == 0) {
+        return 0;
+    }
+    if (b == -1) {
+        return (int)(0u - (unsigned)a);
+    }
+    return a / b;
+}
+
+KERNEL_ESCALAR(SumarGenerico, SumarEscalar)
+KERNEL_ESCALAR(RestarGenerico, RestarEscalar)
+KERNEL_ESCALAR(MultiplicarGenerico, MultiplicarEscalar)
+KERNEL_ESCALAR(DividirGenerico, DividirEscalar)
+REDUCCION_ESCALAR(SumarTodosGenerico, SumarEscalar, 0)
+REDUCCION_ESCALAR(MultiplicarTodosGenerico, MultiplicarEscalar, 1)
+
+#ifdef VECTOR_X86
+
+/**
+ * @brief Divide cuatro pares de enteros usando aritmética de doble precisión, que es exacta para enteros de 32 bits.
+ *
+ * Los divisores nulos se reemplazan por uno y sus resultados se anulan al final.
+ */
+__attribute__((target("sse4.1"))) static inline __m128i DividirSse(__m128i x, __m128i y) {
+    __m128i ceros = _mm_cmpeq_epi32(y, _mm_setzero_si128());
+    __m128i divisor = _mm_blendv_epi8(y, _mm_set1_epi32(1), ceros);
+    __m128i bajos = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(x), _mm_cvtepi32_pd(divisor)));
+    __m128i altos = _mm_cvttpd_epi32(
+        _mm_div_pd(_mm_cvtepi32_pd(_mm_srli_si128(x, 8)), _mm_cvtepi32_pd(_mm_srli_si128(divisor, 8))));
+    return _mm_andnot_si128(ceros, _mm_unpacklo_epi64(bajos, altos));
+}
+
+/**
+ * @brief Divide ocho pares de enteros usando aritmética de doble precisión, que es exacta para enteros de 32 bits.
+ *
+ * Los divisores nulos se reemplazan por uno y sus resultados se anulan al final.
+ */
+__attribute__((target("avx2"))) static inline __m256i DividirAvx2(__m256i x, __m256i y) {
+    __m256i ceros = _mm256_cmpeq_epi32(y, _mm256_setzero_si256());
+    __m256i divisor = _mm256_blendv_epi8(y, _mm256_set1_epi32(1), ceros);
+    __m128i bajos = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(x)),
+                                                      _mm256_cvtepi32_pd(_mm256_castsi256_si128(divisor))));
+    __m128i altos = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)),
+                                                      _mm256_cvtepi32_pd(_mm256_extracti128_si256(divisor, 1))));
+    return _mm256_andnot_si256(ceros, _mm256_set_m128i(altos, bajos));
+}
+
+KERNEL_SIMD(SumarSse, "sse4.1", __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, _mm_add_epi32, SumarEscalar)
+KERNEL_SIMD(RestarSse, "sse4.1", __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, _mm_sub_epi32, RestarEscalar)
+KERNEL_SIMD(MultiplicarSse, "sse4.1", __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, _mm_mullo_epi32,
+            MultiplicarEscalar)
+KERNEL_SIMD(DividirSse4, "sse4.1", __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, DividirSse, DividirEscalar)
+REDUCCION_SIMD(SumarTodosSse, "sse4.1", __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, _mm_set1_epi32, _mm_add_epi32,
+               SumarEscalar, 0)
+REDUCCION_SIMD(MultiplicarTodosSse, "sse4.1", __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, _mm_set1_epi32,
+               _mm_mullo_epi32, MultiplicarEscalar, 1)
+
+KERNEL_SIMD(SumarAvx2, "avx2", __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_add_epi32, SumarEscalar)
+KERNEL_SIMD(RestarAvx2, "avx2", __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_sub_epi32, RestarEscalar)
+KERNEL_SIMD(MultiplicarAvx2, "avx2", __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_mullo_epi32,
+            MultiplicarEscalar)
+KERNEL_SIMD(DividirAvx2x8, "avx2", __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, DividirAvx2, DividirEscalar)
+REDUCCION_SIMD(SumarTodosAvx2, "avx2", __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_set1_epi32,
+               _mm256_add_epi32, SumarEscalar, 0)
+REDUCCION_SIMD(MultiplicarTodosAvx2, "avx2", __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_set1_epi32,
+               _mm256_mullo_epi32, MultiplicarEscalar, 1)
+
+#endif
+
+void ElegirImplementaciones(void) {
+    implementaciones = (struct implementaciones_s){SumarGenerico,       RestarGenerico,     MultiplicarGenerico,
+                                                   DividirGenerico,     SumarTodosGenerico, MultiplicarTodosGenerico};
+
+#ifdef VECTOR_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        implementaciones = (struct implementaciones_s){SumarAvx2,     RestarAvx2,     MultiplicarAvx2,
+                                                       DividirAvx2x8, SumarTodosAvx2, MultiplicarTodosAvx2};
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        implementaciones = (struct implementaciones_s){SumarSse,    RestarSse,     MultiplicarSse,
+                                                       DividirSse4, SumarTodosSse, MultiplicarTodosSse};
+    }
+#endif
+}
+
+/* === Public function implementation ============================================================================== */
+
+void VectorSumar(const int a[], const int b[], int salida[], size_t n) {
+    pthread_once(&implementaciones_elegidas, ElegirImplementaciones);
+    implementaciones.sumar(a, b, salida, n);
+}
+
+void VectorRestar(const int a[], const int b[], int salida[], size_t n) {
+    pthread_once(&implementaciones_elegidas, ElegirImplementaciones);
+    implementaciones.restar(a, b, salida, n);
+}
+
+void VectorMultiplicar(const int a[], const int b[], int salida[], size_t n) {
+    pthread_once(&implementaciones_elegidas, ElegirImplementaciones);
+    implementaciones.multiplicar(a, b, salida, n);
+}
+
+void VectorDividir(const int a[], const int b[], int salida[], size_t n) {
+    pthread_once(&implementaciones_elegidas, ElegirImplementaciones);
+    implementaciones.dividir(a, b, salida, n);
+}
+
+int VectorSumarTodos(const int a[], size_t n) {
+    pthread_once(&implementaciones_elegidas, ElegirImplementaciones);
+    return implementaciones.sumar_todos(a, n);
+}
+
+int VectorMultiplicarTodos(const int a[], size_t n) {
+    pthread_once(&implementaciones_elegidas, ElegirImplementaciones);
+    return implementaciones.multiplicar_todos(a, n);
+}
+
+/* === End of documentation ======================================================================================== */